@@ -41,6 +41,11 @@
 #include <string.h>
 #include <ctype.h>
 #include <assert.h>
+#include <limits.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/inotify.h>
 
 
 /*-----=  Definitions  =-----*/
@@ -166,699 +171,4507 @@
  */
 #define NO_FILES 0
 
+/**
+ * @def MODE_FLAG_INDEX 1
+ * @brief A Macro that sets the index of the mode flag in the arguments array.
+ */
+#define MODE_FLAG_INDEX 1
 
-/*-----=  Structs  =-----*/
+/**
+ * @def DIFF_MODE_FLAG "--diff"
+ * @brief A Flag represents the Diff Mode argument.
+ */
+#define DIFF_MODE_FLAG "--diff"
 
+/**
+ * @def DIFF_ARGUMENTS_NUMBER 4
+ * @brief A Macro that sets the valid number of arguments for the Diff Mode.
+ */
+#define DIFF_ARGUMENTS_NUMBER 4
 
 /**
- * A Structure for a file in the program. It holds the name of the file, and it's dependencies as
- * well as the number of dependencies for this file.
+ * @def OLD_FILE_NAME_INDEX 2
+ * @brief A Macro that sets the index of the old File name in the Diff Mode arguments array.
  */
-typedef struct File
-{
-    char *fileName;
-    int fileDependencies[MAX_NUMBER_OF_DEPENDENCIES];
-    int numberOfDependencies;
-} File;
+#define OLD_FILE_NAME_INDEX 2
 
+/**
+ * @def NEW_FILE_NAME_INDEX 3
+ * @brief A Macro that sets the index of the new File name in the Diff Mode arguments array.
+ */
+#define NEW_FILE_NAME_INDEX 3
 
-/*-----=  Forward Declarations  =-----*/
+/**
+ * @def INVALID_DIFF_ARGUMENTS_MESSAGE
+ * @brief A Macro that sets the output message for invalid arguments in the Diff Mode.
+ */
+#define INVALID_DIFF_ARGUMENTS_MESSAGE "Please supply two files!\n" \
+                                       "usage: CheckDependency --diff <old filename> " \
+                                       "<new filename>\n"
 
+/**
+ * @def NEW_DEPENDENCY_MESSAGE "New cyclic dependency: %s -> %s\n"
+ * @brief A Macro that sets the output message for a new dependency which closes a cycle.
+ */
+#define NEW_DEPENDENCY_MESSAGE "New cyclic dependency: %s -> %s\n"
 
 /**
- * @brief An estimate count for the number of files appears in the input file to read from.
- *        This is only an estimation and some files could be counted more then once.
- * @param pFile The input file containing the data.
- * @return The estimate count number of files.
+ * @def NO_NEW_DEPENDENCY_MESSAGE "No new cyclic dependency\n"
+ * @brief A Macro that sets the output message for a change without new cyclic dependencies.
  */
-static int estimateFilesCount(FILE * const pFile);
+#define NO_NEW_DEPENDENCY_MESSAGE "No new cyclic dependency\n"
 
 /**
- * @brief Perform the first analysis of the input file. The function parse each line into the
- *        desired tokens. It process the data and create the proper File structs with the
- *        processed data, and store it in the general dependencies array.
- *        The function also analyze the File's dependencies and updates them properly.
- *        By the end of this function run, we have created a File struct for each file we have
- *        encountered, and each one of this File structs stores it's dependencies as desired.
- * @param pFile The input file to read.
- * @param dependencies The general dependencies array which holds the File structs.
+ * @def FILES_TABLE_LOAD_FACTOR 2
+ * @brief A Macro that sets the minimal ratio between the Files Table size and the number of Files.
  */
-static void processFile(FILE * const pFile, File *dependencies);
+#define FILES_TABLE_LOAD_FACTOR 2
 
 /**
- * @brief Analyze the data that has been processed from the input file.
- *        Using the DFS Algorithm, this function determines if there is a cyclic dependency
- *        or not.
- * @param dependencies The general dependencies array which holds the File structs.
- * @return true if there is a cyclic dependency, false otherwise.
+ * @def EMPTY_SLOT -1
+ * @brief A Flag for an empty slot in the Files Table.
  */
-static bool analyzeData(File * const dependencies);
+#define EMPTY_SLOT -1
 
 /**
- * @brief Runs a DFS Algorithm on a given file.
- * @param currentFile The pointer for the current file to run DFS on.
- * @param dependencies The general dependencies array which holds the File structs.
- * @param currentDependencies The currently visited files.
- * @param visited All the files that were absolutely visited during the entire program run,
- *        i.e. a file in this array is a file which was visited and also all of its neighbours
- *        were visited.
- * @param currentIndex The current available index in the currentDependencies array.
- * @return true if there is a cyclic dependency, false otherwise.
+ * @def HASH_INITIAL_VALUE 5381
+ * @brief A Macro that sets the initial value of the File name hash function (djb2).
  */
-static bool dfs(File * const currentFile, File * const dependencies, File *currentDependencies,
-                File *visited, int *currentIndex);
+#define HASH_INITIAL_VALUE 5381
 
 /**
- * @brief Determine if the given file name appears in the given dependencies array.
- *        This function used in the DFS Algorithm.
- * @param fileName The file name to check.
- * @param dependencies The array to check in.
- * @param count The current amount of files in the dependencies.
- * @return true if there is a cyclic dependency, false otherwise.
+ * @def HASH_SHIFT 5
+ * @brief A Macro that sets the shift of the File name hash function (djb2).
  */
-static bool dfsContains(char const *fileName, File * const dependencies, int count);
+#define HASH_SHIFT 5
 
 /**
- * @brief With the given results from the analysis process, this function perform the required
- *        actions in each scenario (cyclic or no cyclic dependency).
- * @param result A boolean variable holding the result from the analysis process.
+ * @def EDGES_SET_LOAD_FACTOR 2
+ * @brief A Macro that sets the minimal ratio between the Edges Set size and the number of Edges.
  */
-static void analyzeResult(bool const result);
+#define EDGES_SET_LOAD_FACTOR 2
 
 /**
- * @brief Handles the entire process of receiving the input from the user and process it.
- *        The function verifies a valid number of arguments, and that the given arguments are
- *        valid as well (i.e. valid input file).
- *        The function returns a pointer to the input file which was as an argument.
- * @param argc The number of given arguments.
- * @param argv[] The arguments from the user.
- * @return A pointer to the input file which was as an argument if the input is valid,
- *         otherwise returns NULL pointer.
+ * @def EDGE_HASH_MULTIPLIER 2654435761u
+ * @brief A Macro that sets the multiplier which spreads the hash value of an Edge (Knuth).
  */
-static FILE * handleInput(int argc, char *argv[]);
+#define EDGE_HASH_MULTIPLIER 2654435761u
 
 /**
- * @brief Free the memory of given several Files.
- * @param dependencies The pointer to the Files to free.
+ * @def EDGE_HASH_FOLD 16
+ * @brief A Macro that sets the shift which folds the high bits of an Edge hash value into the
+ *        low bits, which select the slot.
  */
-static void freeAllFiles(File * const dependencies);
+#define EDGE_HASH_FOLD 16
 
 /**
- * @brief Initialize a given File struct with the desired parameters.
- * @param file A pointer to the File struct to initialize.
- * @param fileName The name of the File.
- * @param numberOfDependencies The number of dependencies of the given File.
- * @return true iff succeed.
+ * @def NOT_MARKED 0
+ * @brief A Macro that sets the mark of a File which was not reached in any search yet.
  */
-static bool initializeFile(File *file, char const *fileName, int const numberOfDependencies);
+#define NOT_MARKED 0
 
 /**
- * @brief Counts the amount of dependencies of a file in a given line.
- * @param currentLine The current line to check.
- * @return The number of dependencies the file in the given line has.
+ * @def WATCH_MODE_FLAG "--watch"
+ * @brief A Flag represents the Watch Mode argument.
  */
-static int countDependencies(char *currentLine);
+#define WATCH_MODE_FLAG "--watch"
 
 /**
- * @brief Creating and adding a new File struct instance to the general dependencies array.
- * @param fileName The file name for the File struct.
- * @param dependencies The general dependencies array which stores the Files.
- * @param numberOfDependencies The number of dependencies of the new File.
- * @return The index of the new File in the dependencies array.
+ * @def WATCH_ARGUMENTS_NUMBER 3
+ * @brief A Macro that sets the valid number of arguments for the Watch Mode.
  */
-static int addNewFile(char const *fileName, File dependencies[], int const numberOfDependencies);
+#define WATCH_ARGUMENTS_NUMBER 3
 
 /**
- * @brief Updates a given File with new number of dependencies and allocating new memory for it's
- *        dependencies.
- * @param file The File to update.
- * @param numberOfDependencies The number of dependencies to add to the current count.
+ * @def WATCH_FILE_NAME_INDEX 2
+ * @brief A Macro that sets the index of the File name in the Watch Mode arguments array.
  */
-static void updateExistingFile(File *file, int const numberOfDependencies);
+#define WATCH_FILE_NAME_INDEX 2
 
 /**
- * @brief Adds new dependency to a given File if it does not exists already. The new dependency is
- *        represented as an integer, which states the index of it in the general dependencies
- *        array.
- * @param file A pointer to the File we are about to update.
- * @param fileIndex The file index representing the new dependency file.
- * @param indexToStore The current available index by order in the File's dependencies
- *                     array to insert the new dependency.
+ * @def INVALID_WATCH_ARGUMENTS_MESSAGE
+ * @brief A Macro that sets the output message for invalid arguments in the Watch Mode.
  */
-static void addNewDependency(File *file, int const fileIndex, int *indexToStore);
+#define INVALID_WATCH_ARGUMENTS_MESSAGE "Please supply one file!\n" \
+                                        "usage: CheckDependency --watch <filename>\n"
 
 /**
- * @brief Determine if a given dependency file index has already exists as a dependency of the
- *        given file pointer.
- * @param file A pointer to the File contains dependencies.
- * @param fileIndex The file index representing the dependency file.
- * @param index The first index not occupied in the file dependencies array.
- * @return true if the dependency file exists, false otherwise.
+ * @def WATCH_ERROR_MESSAGE "Error! trying to watch the file %s\n"
+ * @brief A Macro that sets the output message for a failure to watch the input file.
  */
-static bool containsDependency(File * const file, int const fileIndex, int const index);
+#define WATCH_ERROR_MESSAGE "Error! trying to watch the file %s\n"
 
 /**
- * @brief Determine if a given file name has already appears in the File's dependencies array.
- *        If the file exists, the function returns it's index in the array, otherwise the function
- *        returns -1
- * @param fileName The file name to check.
- * @param dependencies The array which contains the existing Files.
- * @return The index of the given file name in the array if exists, otherwise returns -1.
+ * @def WATCH_EVENTS (IN_CLOSE_WRITE | IN_MOVED_TO)
+ * @brief A Macro that sets the events which declare that the watched file was saved, either in
+ *        place or by replacing it with a new file.
  */
-static int containsFile(char const *fileName, File * const dependencies);
+#define WATCH_EVENTS (IN_CLOSE_WRITE | IN_MOVED_TO)
 
+/**
+ * @def EVENTS_BUFFER_COUNT 64
+ * @brief A Macro that sets the number of event headers the events buffer can hold.
+ */
+#define EVENTS_BUFFER_COUNT 64
 
-/*-----=  Global Variables  =-----*/
+/**
+ * @def CURRENT_DIRECTORY "."
+ * @brief A Macro that sets the directory of a file name without a directory part.
+ */
+#define CURRENT_DIRECTORY "."
 
+/**
+ * @def PATH_SEPARATOR '/'
+ * @brief A Macro that sets the separator between the directories in a path.
+ */
+#define PATH_SEPARATOR '/'
 
-int gNumberOfFiles = NO_FILES;
+/**
+ * @def LINE_SEPARATOR '\n'
+ * @brief A Macro that sets the separator between lines in the input file.
+ */
+#define LINE_SEPARATOR '\n'
 
+/**
+ * @def STRING_TERMINATOR '\0'
+ * @brief A Macro that sets the string terminator character.
+ */
+#define STRING_TERMINATOR '\0'
 
-/*-----=  Main  =-----*/
+/**
+ * @def NO_LINE -1
+ * @brief A Flag for the end of the list of the lines which declare a File in the Watch Mode.
+ */
+#define NO_LINE -1
 
+/**
+ * @def CAPACITY_GROWTH_FACTOR 2
+ * @brief A Macro that sets the factor by which the capacity of the Files array grows.
+ */
+#define CAPACITY_GROWTH_FACTOR 2
 
 /**
- * @brief The main function that runs the program.
- *        The function receive file path as input from the user, and analyze the file's data.
- *        If the user input is invalid, the program ends and return -1;
- *        The function determine if there is a cyclic dependency in the given file or not,
- *        and prints an informative message to the standard output.
- * @param argc The number of given arguments.
- * @param argv[] The arguments from the user.
- * @return 0 if the program run ended successfully, -1 if an error occurred.
+ * @def OUT_OF_CORE_MODE_FLAG "--out-of-core"
+ * @brief A Flag represents the Out Of Core Mode argument.
  */
-int main(int argc, char *argv[])
-{
-    FILE * pFile = handleInput(argc, argv);
+#define OUT_OF_CORE_MODE_FLAG "--out-of-core"
 
-    if (pFile == NULL)
-    {
-        return INVALID_STATE;
-    }
-    else
-    {
-        File *dependencies = NULL;
+/**
+ * @def OUT_OF_CORE_ARGUMENTS_NUMBER 4
+ * @brief A Macro that sets the valid number of arguments for the Out Of Core Mode.
+ */
+#define OUT_OF_CORE_ARGUMENTS_NUMBER 4
 
-        // An estimate number of files, not accurate but it's used only to serve the memory
-        // allocation for 'dependencies'.
-        int const countEstimate = estimateFilesCount(pFile);
-        assert(countEstimate >= NO_FILES);
-        dependencies = (File *)malloc(countEstimate * sizeof(File));
+/**
+ * @def MEMORY_BUDGET_INDEX 2
+ * @brief A Macro that sets the index of the memory budget in the Out Of Core Mode arguments array.
+ */
+#define MEMORY_BUDGET_INDEX 2
 
-        // Process the data of the file and close it's stream.
-        processFile(pFile, dependencies);
-        fclose(pFile);
+/**
+ * @def OUT_OF_CORE_FILE_NAME_INDEX 3
+ * @brief A Macro that sets the index of the File name in the Out Of Core Mode arguments array.
+ */
+#define OUT_OF_CORE_FILE_NAME_INDEX 3
 
-        // Determine if there is Cyclic Dependency, and free all allocated memory.
-        bool const result = analyzeData(dependencies);
-        analyzeResult(result);
+/**
+ * @def INVALID_OUT_OF_CORE_ARGUMENTS_MESSAGE
+ * @brief A Macro that sets the output message for invalid arguments in the Out Of Core Mode.
+ */
+#define INVALID_OUT_OF_CORE_ARGUMENTS_MESSAGE "Please supply a memory budget and one file!\n" \
+                                              "usage: CheckDependency --out-of-core " \
+                                              "<budget in KB> <filename>\n"
 
-        // Free Memory.
-        freeAllFiles(dependencies);
-        free(dependencies);
+/**
+ * @def TEMPORARY_FILE_ERROR_MESSAGE "Error! trying to create a temporary file\n"
+ * @brief A Macro that sets the output message for a failure to spill data to the disk.
+ */
+#define TEMPORARY_FILE_ERROR_MESSAGE "Error! trying to create a temporary file\n"
 
-        return VALID_STATE;
-    }
-}
+/**
+ * @def KILOBYTE 1024
+ * @brief A Macro that sets the number of bytes in a kilobyte.
+ */
+#define KILOBYTE 1024
 
+/**
+ * @def DECIMAL_BASE 10
+ * @brief A Macro that sets the base of the memory budget argument.
+ */
+#define DECIMAL_BASE 10
 
-/*-----=  Analyze Input File  =-----*/
+/**
+ * @def MIN_EDGES_BUFFER_SIZE 2
+ * @brief A Macro that sets the minimal number of Edges held in the memory at once.
+ */
+#define MIN_EDGES_BUFFER_SIZE 2
 
+/**
+ * @def MIN_MEMORY_BUDGET 32
+ * @brief A Macro that sets the smallest memory budget in KB, smaller budgets are raised to it so
+ *        the buffers of the streams leave room for the Edges.
+ */
+#define MIN_MEMORY_BUDGET 32
 
 /**
- * @brief An estimate count for the number of files appears in the input file to read from.
- *        This is only an estimation and some files could be counted more then once.
- * @param pFile The input file containing the data.
- * @return The estimate count number of files.
+ * @def MAX_MEMORY_BUDGET 2097152
+ * @brief A Macro that sets the largest memory budget in KB, larger budgets are lowered to it so
+ *        the budget in bytes and in Edges does not overflow.
  */
-static int estimateFilesCount(FILE * const pFile)
-{
-    assert(pFile != NULL);
-    int counter = NO_FILES;
-    char currentLine[MAX_LINE_SIZE] = {};
-    while (fgets(currentLine, MAX_LINE_SIZE, pFile) != NULL)
-    {
-        counter++;  // A new line declare a new file (not always but it is an estimate count).
-        int numberOfDependencies = countDependencies(currentLine);
-        counter += numberOfDependencies;
-    }
-    rewind(pFile);  // Resets the file to the beginning for the next functions use.
-    return counter;
-}
+#define MAX_MEMORY_BUDGET 2097152
 
 /**
- * @brief Perform the first analysis of the input file. The function parse each line into the
- *        desired tokens. It process the data and create the proper File structs with the
- *        processed data, and store it in the general dependencies array.
- *        The function also analyze the File's dependencies and updates them properly.
- *        By the end of this function run, we have created a File struct for each file we have
- *        encountered, and each one of this File structs stores it's dependencies as desired.
- * @param pFile The input file to read.
- * @param dependencies The general dependencies array which holds the File structs.
+ * @def OPEN_STREAMS 2
+ * @brief A Macro that sets the number of streams the Out Of Core Mode has open at once, whose
+ *        buffers are counted in the memory budget.
  */
-static void processFile(FILE * const pFile, File *dependencies)
-{
-    // The current line read from the input file.
-    char currentLine[MAX_LINE_SIZE] = {};
+#define OPEN_STREAMS 2
 
-    // Analyzing each line in the file.
-    while (fgets(currentLine, MAX_LINE_SIZE, pFile) != NULL)
-    {
-        // Each new line we initialize these variables which helps us with processing the line.
-        char currentLineCopy[MAX_LINE_SIZE] = {};
-        File *currentFile = NULL;
-        char *fileName = NULL;
-        char *fileDependency = NULL;
-        int index = START_INDEX;
-
-        // Count the number of dependencies in this current line.
-        // We copy the current line in order to perform manipulations on it without changing it.
-        strcpy(currentLineCopy, currentLine);
-        int const numberOfDependencies = countDependencies(currentLineCopy);
-        assert(numberOfDependencies >= NO_DEPENDENCIES);
-
-        // File name process.
-        fileName = strtok(currentLine, FILE_NAME_DELIMITER);
-        // Determine if the current file is already exists in the dependencies array.
-        // If the file does not exist, we create a new File struct and store it in the
-        // dependencies array.
-        // If the file exists, we find it in the dependencies array and update it's current number
-        // of dependencies.
-        int currentFileIndex = containsFile(fileName, dependencies);
-        if (currentFileIndex == FILE_NOT_FOUND)
-        {
-            currentFileIndex = addNewFile(fileName, dependencies, numberOfDependencies);
-            currentFile = &(dependencies[currentFileIndex]);
-        }
-        else
-        {
-            currentFile = &(dependencies[currentFileIndex]);
-            assert(currentFile != NULL);
-            assert(currentFile -> numberOfDependencies >= NO_DEPENDENCIES);
-            index = currentFile -> numberOfDependencies;
-            updateExistingFile(currentFile, numberOfDependencies);
-        }
+/**
+ * @def MIN_MERGE_FAN_IN 2
+ * @brief A Macro that sets the minimal number of runs merged together in a single merge pass.
+ */
+#define MIN_MERGE_FAN_IN 2
 
-        // File's dependencies process.
-        fileDependency = strtok(NULL, FIRST_DEPENDENCY_DELIMITER);
-        while (fileDependency != NULL)
-        {
-            // If we encountered a file which does not exists already, we create for it a new
-            // File struct and store it in the dependencies array.
-            int currentDependencyIndex = containsFile(fileDependency, dependencies);
-            if (currentDependencyIndex == FILE_NOT_FOUND)
-            {
-                currentDependencyIndex = addNewFile(fileDependency, dependencies, NO_DEPENDENCIES);
-            }
+/**
+ * @def TRIMMED_EDGES_FRACTION 8
+ * @brief A Macro that sets the fraction of the Edges a trimming pass must remove, 1 of this many,
+ *        for another trimming pass to run.
+ */
+#define TRIMMED_EDGES_FRACTION 8
 
-            // Assign the index of the file from the general dependencies array into the current
-            // file's dependencies.
-            addNewDependency(currentFile, currentDependencyIndex, &index);
+/**
+ * @def NAMES_BLOCK_SIZE 65536
+ * @brief A Macro that sets the size of a single block of file names in the Names Table.
+ */
+#define NAMES_BLOCK_SIZE 65536
 
-            fileDependency = strtok(NULL, DEPENDENCY_DELIMITER);
-        }
-    }
-    return;
-}
+/**
+ * @def WHITE 0
+ * @brief A Flag for a File which was not visited yet during the DFS on the residue.
+ */
+#define WHITE 0
 
 /**
- * @brief Analyze the data that has been processed from the input file.
- *        Using the DFS Algorithm, this function determines if there is a cyclic dependency
- *        or not.
- * @param dependencies The general dependencies array which holds the File structs.
- * @return true if there is a cyclic dependency, false otherwise.
+ * @def GRAY 1
+ * @brief A Flag for a File which is currently visited during the DFS on the residue.
  */
-static bool analyzeData(File * const dependencies)
-{
-    File *currentFile = NULL;
-    File *visited = NULL;
-    visited = (File *)malloc(gNumberOfFiles * sizeof(File));
-    assert(visited != NULL);
+#define GRAY 1
 
-    int i;
-    for (i = 0 ; i < gNumberOfFiles; i++)
-    {
+/**
+ * @def BLACK 2
+ * @brief A Flag for a File which was visited with all of it's neighbours during the DFS on the
+ *        residue.
+ */
+#define BLACK 2
+
+/**
+ * @def FEEDBACK_MODE_FLAG "--feedback"
+ * @brief A Flag represents the Feedback Mode argument.
+ */
+#define FEEDBACK_MODE_FLAG "--feedback"
+
+/**
+ * @def MODE_ARGUMENTS_NUMBER 3
+ * @brief A Macro that sets the valid number of arguments for a mode with a single input file.
+ */
+#define MODE_ARGUMENTS_NUMBER 3
+
+/**
+ * @def MODE_FILE_NAME_INDEX 2
+ * @brief A Macro that sets the index of the File name in the arguments array of a mode with a
+ *        single input file.
+ */
+#define MODE_FILE_NAME_INDEX 2
+
+/**
+ * @def INVALID_FEEDBACK_ARGUMENTS_MESSAGE
+ * @brief A Macro that sets the output message for invalid arguments in the Feedback Mode.
+ */
+#define INVALID_FEEDBACK_ARGUMENTS_MESSAGE "Please supply one file!\n" \
+                                           "usage: CheckDependency --feedback <filename>\n"
+
+/**
+ * @def FEEDBACK_COMPONENT_MESSAGE
+ * @brief A Macro that sets the output message for a group of files with cyclic dependencies.
+ */
+#define FEEDBACK_COMPONENT_MESSAGE "Cyclic dependency among %d files, " \
+                                   "suggested dependencies to remove:\n"
+
+/**
+ * @def FEEDBACK_EDGE_MESSAGE "    %d. %s -> %s\n"
+ * @brief A Macro that sets the output message for a single suggested dependency to remove.
+ */
+#define FEEDBACK_EDGE_MESSAGE "    %d. %s -> %s\n"
+
+/**
+ * @def NOT_DISCOVERED -1
+ * @brief A Flag for a File which was not discovered yet while finding the Components.
+ */
+#define NOT_DISCOVERED -1
+
+/**
+ * @def SINKS_LIST 0
+ * @brief A Macro that sets the list of Files without remaining dependencies in the ordering.
+ */
+#define SINKS_LIST 0
+
+/**
+ * @def SOURCES_LIST 1
+ * @brief A Macro that sets the list of Files without remaining dependants in the ordering.
+ */
+#define SOURCES_LIST 1
+
+/**
+ * @def FIRST_BUCKET_LIST 2
+ * @brief A Macro that sets the first list of Files by the difference of their dependencies and
+ *        dependants count in the ordering.
+ */
+#define FIRST_BUCKET_LIST 2
+
+/**
+ * @def SELF_DEPENDENCY_SPAN INT_MAX
+ * @brief A Macro that sets the rank of a File which depends on itself, such a dependency must
+ *        always be removed.
+ */
+#define SELF_DEPENDENCY_SPAN INT_MAX
+
+/**
+ * @def CLOSURE_MODE_FLAG "--closure"
+ * @brief A Flag represents the Closure Mode argument.
+ */
+#define CLOSURE_MODE_FLAG "--closure"
+
+/**
+ * @def FIRST_QUERY_INDEX 3
+ * @brief A Macro that sets the index of the first queried file name in the Closure Mode
+ *        arguments array.
+ */
+#define FIRST_QUERY_INDEX 3
+
+/**
+ * @def INVALID_CLOSURE_ARGUMENTS_MESSAGE
+ * @brief A Macro that sets the output message for invalid arguments in the Closure Mode.
+ */
+#define INVALID_CLOSURE_ARGUMENTS_MESSAGE "Please supply one file!\n" \
+                                          "usage: CheckDependency --closure <filename> " \
+                                          "[file name ...]\n"
+
+/**
+ * @def CLOSURE_MEMORY_MESSAGE "Error! the closure of %d components does not fit the memory\n"
+ * @brief A Macro that sets the output message for a closure which is too large to allocate.
+ */
+#define CLOSURE_MEMORY_MESSAGE "Error! the closure of %d components does not fit the memory\n"
+
+/**
+ * @def CLOSURE_SIZE_MESSAGE
+ * @brief A Macro that sets the output message for the size of the closure and the time it took.
+ */
+#define CLOSURE_SIZE_MESSAGE "Transitive closure: %lld pairs of %d files, computed in %.3f ms\n"
+
+/**
+ * @def CLOSURE_QUERY_MESSAGE "%s transitively includes %lld files:\n"
+ * @brief A Macro that sets the output message for the reachable set of a queried file.
+ */
+#define CLOSURE_QUERY_MESSAGE "%s transitively includes %lld files:\n"
+
+/**
+ * @def CLOSURE_FILE_MESSAGE "    %s\n"
+ * @brief A Macro that sets the output message for a single file in a reachable set.
+ */
+#define CLOSURE_FILE_MESSAGE "    %s\n"
+
+/**
+ * @def UNKNOWN_FILE_MESSAGE "%s does not appear in the input file\n"
+ * @brief A Macro that sets the output message for a queried file which does not exist.
+ */
+#define UNKNOWN_FILE_MESSAGE "%s does not appear in the input file\n"
+
+/**
+ * @def WORD_BITS 64
+ * @brief A Macro that sets the number of bits in a single word of a bitset.
+ */
+#define WORD_BITS 64
+
+/**
+ * @def MILLISECONDS_PER_SECOND 1000.0
+ * @brief A Macro that sets the number of milliseconds in a second.
+ */
+#define MILLISECONDS_PER_SECOND 1000.0
+
+#ifdef STATS
+/**
+ * @def STATS_ADD(counter, count) ((gStats.counter) += (count))
+ * @brief A Macro that adds to a counter of the Stats and returns its new value.
+ *        Without STATS it is compiled out.
+ */
+#define STATS_ADD(counter, count) ((gStats.counter) += (count))
+#else
+#define STATS_ADD(counter, count) ((void)0)
+#endif
+
+/**
+ * @def STATS_CALL(function) STATS_ADD(calls[function], 1)
+ * @brief A Macro that counts a call of a function in the Stats.
+ */
+#define STATS_CALL(function) STATS_ADD(calls[function], 1)
+
+/**
+ * @def STATS_OUTPUT "%-20s %ld\n"
+ * @brief A Macro that sets the output of a single counter of the Stats.
+ */
+#define STATS_OUTPUT "%-20s %ld\n"
+
+
+/*-----=  Structs  =-----*/
+
+
+/**
+ * A Structure for a file in the program. It holds the name of the file, and it's dependencies as
+ * well as the number of dependencies for this file.
+ */
+typedef struct File
+{
+    char *fileName;
+    int fileDependencies[MAX_NUMBER_OF_DEPENDENCIES];
+    int numberOfDependencies;
+} File;
+
+/**
+ * A Structure for the content of an input file. It holds the entire content of the file in a
+ * single buffer, and the lines of the file as pointers into this buffer.
+ */
+typedef struct Manifest
+{
+    char *content;
+    char **lines;
+    int numberOfLines;
+} Manifest;
+
+/**
+ * A Structure for the strongly connected Components of the graph of the Files, which can be found
+ * again for only a part of the graph. It holds the Component number of each File, whether it is
+ * on a cycle, the number of such Files and the next Component number. It also holds the buffers
+ * of the searches, which have room for capacity Files, and the marks of the Files, a File is
+ * reached in the current search iff it's mark is stamp.
+ */
+typedef struct Components
+{
+    int *component;
+    bool *cyclic;
+    int numberOfCyclicFiles;
+    int numberOfComponents;
+    int *marks;
+    int stamp;
+    int *discovery;
+    int *lowLink;
+    int *positions;
+    int *stack;
+    int *callStack;
+    bool *onStack;
+    int capacity;
+} Components;
+
+/**
+ * A Structure for the resident state of the Watch Mode. It holds the general dependencies array
+ * and it's capacity, the last content of the watched file, the File declared in each of it's
+ * lines and the lines which declare each File, as a list through the next line of each line, and
+ * the Components of the graph.
+ */
+typedef struct WatchState
+{
+    File *dependencies;
+    int capacity;
+    Manifest manifest;
+    int *lineFiles;
+    int *nextLines;
+    int *firstLines;
+    Components components;
+} WatchState;
+
+/**
+ * A Structure for a single dependency in the Out Of Core Mode, from the index of the declaring
+ * file to the index of the file it depends on.
+ */
+typedef struct Edge
+{
+    int from;
+    int to;
+} Edge;
+
+/**
+ * A Structure for a set of Edges, an open addressing hash table whose size is a power of two.
+ * An empty slot holds an Edge from EMPTY_SLOT.
+ */
+typedef struct EdgesSet
+{
+    Edge *slots;
+    int size;
+} EdgesSet;
+
+/**
+ * A Structure for the names of the files in the Out Of Core Mode. It maps a file name to it's
+ * index without holding a File struct for each file. The names are stored one after the other in
+ * large blocks, each block starts with a pointer to the previous block.
+ */
+typedef struct NamesTable
+{
+    char **names;
+    int numberOfNames;
+    int capacity;
+    int *slots;
+    int numberOfSlots;
+    char *block;
+    int blockUsed;
+} NamesTable;
+
+/**
+ * A Structure for a suggested dependency to remove in the Feedback Mode. It holds the Edge, the
+ * Component it breaks and it's rank - the distance it goes backwards in the ordering.
+ */
+typedef struct FeedbackEdge
+{
+    Edge edge;
+    int component;
+    int span;
+} FeedbackEdge;
+
+/**
+ * A Structure for a sorted run of Edges in the file of the runs, while it is merged. It holds the
+ * position of it's next Edge on the disk and of it's end, and the part of the memory it is read
+ * into with the Edges read so far and the index of the next Edge to merge among them.
+ */
+typedef struct Run
+{
+    long position;
+    long end;
+    Edge *edges;
+    int capacity;
+    int size;
+    int next;
+} Run;
+
+/**
+ * An enum for the functions whose calls are counted in the Stats.
+ */
+typedef enum CountedFunction
+{
+    PROCESS_LINE_CALL,
+    CONTAINS_FILE_CALL,
+    ADD_NEW_FILE_CALL,
+    ADD_NEW_DEPENDENCY_CALL,
+    DFS_CALL,
+    REACHES_FILE_CALL,
+    SEARCH_COMPONENTS_CALL,
+    INTERN_NAME_CALL,
+    NUMBER_OF_COUNTED_FUNCTIONS
+} CountedFunction;
+
+/**
+ * A Structure for the Stats of the program, which exist only when it is built with STATS.
+ * It holds the number of allocations and frees, the number of bytes they hold now and at their
+ * peak, the number of string comparisons and the number of calls of each counted function.
+ */
+typedef struct Stats
+{
+    long allocations;
+    long frees;
+    long bytes;
+    long peakBytes;
+    long comparisons;
+    long calls[NUMBER_OF_COUNTED_FUNCTIONS];
+} Stats;
+
+/**
+ * A Union for the header of an allocation counted in the Stats, which holds its size and is
+ * aligned as any allocation.
+ */
+typedef union AllocationHeader
+{
+    size_t size;
+    long double alignment;
+    void *pointer;
+} AllocationHeader;
+
+
+/*-----=  Forward Declarations  =-----*/
+
+
+/**
+ * @brief An estimate count for the number of files appears in the input file to read from.
+ *        This is only an estimation and some files could be counted more then once.
+ * @param pFile The input file containing the data.
+ * @return The estimate count number of files.
+ */
+static int estimateFilesCount(FILE * const pFile);
+
+/**
+ * @brief Perform the first analysis of the input file. The function parse each line into the
+ *        desired tokens. It process the data and create the proper File structs with the
+ *        processed data, and store it in the general dependencies array.
+ *        The function also analyze the File's dependencies and updates them properly.
+ *        By the end of this function run, we have created a File struct for each file we have
+ *        encountered, and each one of this File structs stores it's dependencies as desired.
+ * @param pFile The input file to read.
+ * @param dependencies The general dependencies array which holds the File structs.
+ */
+static void processFile(FILE * const pFile, File *dependencies);
+
+/**
+ * @brief Process a single line of the input file. The function creates the File structs of the
+ *        file declared in the line and of it's dependencies if they do not exist already, and adds
+ *        the dependencies to the declared File.
+ * @param currentLine The line to process, it's content is changed during the process.
+ * @param dependencies The general dependencies array which holds the File structs.
+ */
+static void processLine(char *currentLine, File *dependencies);
+
+/**
+ * @brief Analyze the data that has been processed from the input file.
+ *        Using the DFS Algorithm, this function determines if there is a cyclic dependency
+ *        or not.
+ * @param dependencies The general dependencies array which holds the File structs.
+ * @return true if there is a cyclic dependency, false otherwise.
+ */
+static bool analyzeData(File * const dependencies);
+
+/**
+ * @brief Runs a DFS Algorithm on a given file.
+ * @param currentFile The pointer for the current file to run DFS on.
+ * @param dependencies The general dependencies array which holds the File structs.
+ * @param currentDependencies The currently visited files.
+ * @param visited All the files that were absolutely visited during the entire program run,
+ *        i.e. a file in this array is a file which was visited and also all of its neighbours
+ *        were visited.
+ * @param currentIndex The current available index in the currentDependencies array.
+ * @param visitedIndex The last occupied index in the visited array.
+ * @return true if there is a cyclic dependency, false otherwise.
+ */
+static bool dfs(File * const currentFile, File * const dependencies, File *currentDependencies,
+                File *visited, int *currentIndex, int *visitedIndex);
+
+/**
+ * @brief Determine if the given file name appears in the given dependencies array.
+ *        This function used in the DFS Algorithm.
+ * @param fileName The file name to check.
+ * @param dependencies The array to check in.
+ * @param count The current amount of files in the dependencies.
+ * @return true if there is a cyclic dependency, false otherwise.
+ */
+static bool dfsContains(char const *fileName, File * const dependencies, int count);
+
+/**
+ * @brief With the given results from the analysis process, this function perform the required
+ *        actions in each scenario (cyclic or no cyclic dependency).
+ * @param result A boolean variable holding the result from the analysis process.
+ */
+static void analyzeResult(bool const result);
+
+/**
+ * @brief Handles the entire process of receiving the input from the user and process it.
+ *        The function verifies a valid number of arguments, and that the given arguments are
+ *        valid as well (i.e. valid input file).
+ *        The function returns a pointer to the input file which was as an argument.
+ * @param argc The number of given arguments.
+ * @param argv[] The arguments from the user.
+ * @return A pointer to the input file which was as an argument if the input is valid,
+ *         otherwise returns NULL pointer.
+ */
+static FILE * handleInput(int argc, char *argv[]);
+
+/**
+ * @brief Free the memory of given several Files.
+ * @param dependencies The pointer to the Files to free.
+ */
+static void freeAllFiles(File * const dependencies);
+
+/**
+ * @brief Initialize a given File struct with the desired parameters.
+ * @param file A pointer to the File struct to initialize.
+ * @param fileName The name of the File.
+ * @param numberOfDependencies The number of dependencies of the given File.
+ * @return true iff succeed.
+ */
+static bool initializeFile(File *file, char const *fileName, int const numberOfDependencies);
+
+/**
+ * @brief Counts the amount of dependencies of a file in a given line.
+ * @param currentLine The current line to check.
+ * @return The number of dependencies the file in the given line has.
+ */
+static int countDependencies(char *currentLine);
+
+/**
+ * @brief Creating and adding a new File struct instance to the general dependencies array.
+ * @param fileName The file name for the File struct.
+ * @param dependencies The general dependencies array which stores the Files.
+ * @param numberOfDependencies The number of dependencies of the new File.
+ * @return The index of the new File in the dependencies array.
+ */
+static int addNewFile(char const *fileName, File dependencies[], int const numberOfDependencies);
+
+/**
+ * @brief Updates a given File with new number of dependencies and allocating new memory for it's
+ *        dependencies.
+ * @param file The File to update.
+ * @param numberOfDependencies The number of dependencies to add to the current count.
+ */
+static void updateExistingFile(File *file, int const numberOfDependencies);
+
+/**
+ * @brief Adds new dependency to a given File if it does not exists already. The new dependency is
+ *        represented as an integer, which states the index of it in the general dependencies
+ *        array.
+ * @param file A pointer to the File we are about to update.
+ * @param fileIndex The file index representing the new dependency file.
+ * @param indexToStore The current available index by order in the File's dependencies
+ *                     array to insert the new dependency.
+ */
+static void addNewDependency(File *file, int const fileIndex, int *indexToStore);
+
+/**
+ * @brief Determine if a given dependency file index has already exists as a dependency of the
+ *        given file pointer.
+ * @param file A pointer to the File contains dependencies.
+ * @param fileIndex The file index representing the dependency file.
+ * @param index The first index not occupied in the file dependencies array.
+ * @return true if the dependency file exists, false otherwise.
+ */
+static bool containsDependency(File * const file, int const fileIndex, int const index);
+
+/**
+ * @brief Determine if a given file name has already appears in the File's dependencies array.
+ *        If the file exists, the function returns it's index in the array, otherwise the function
+ *        returns -1
+ * @param fileName The file name to check.
+ * @param dependencies The array which contains the existing Files.
+ * @return The index of the given file name in the array if exists, otherwise returns -1.
+ */
+static int containsFile(char const *fileName, File * const dependencies);
+
+/**
+ * @brief Computes the hash value of a given file name (djb2).
+ * @param fileName The file name to hash.
+ * @return The hash value of the file name.
+ */
+static unsigned int hashFileName(char const *fileName);
+
+/**
+ * @brief Allocates the Files Table, which maps a file name to it's index in the general
+ *        dependencies array, for the given number of Files.
+ * @param capacity The maximal number of Files the table should index.
+ * @return true iff succeed.
+ */
+static bool createFilesTable(int const capacity);
+
+/**
+ * @brief Free the memory of the Files Table.
+ */
+static void freeFilesTable();
+
+/**
+ * @brief Adds the File in the given index of the general dependencies array to the Files Table.
+ * @param fileName The name of the File to add.
+ * @param fileIndex The index of the File in the general dependencies array.
+ */
+static void addToFilesTable(char const *fileName, int const fileIndex);
+
+/**
+ * @brief Runs the program in the Diff Mode. The function parses both of the given input files
+ *        into a shared name space, and reports only the cyclic dependencies which were
+ *        introduced by the new input file relative to the old one.
+ * @param argc The number of given arguments.
+ * @param argv[] The arguments from the user.
+ * @return 0 if the program run ended successfully, -1 if an error occurred.
+ */
+static int runDiffMode(int argc, char *argv[]);
+
+/**
+ * @brief Analyze the difference between the old and the new dependencies. The dependencies that
+ *        appear only in the new dependencies are found with the set of the old ones, and a single
+ *        search from all of them finds which close a cycle.
+ * @param dependencies The general dependencies array which holds the new File structs.
+ * @param oldEdges A pointer to the set of the dependencies of the old input file.
+ * @return true if there is a new cyclic dependency, false otherwise.
+ */
+static bool analyzeDiff(File * const dependencies, EdgesSet const *oldEdges);
+
+/**
+ * @brief Allocates an empty Edges Set for the given number of Edges.
+ * @param set A pointer to the Edges Set.
+ * @param numberOfEdges The maximal number of Edges the set should hold.
+ * @return true iff succeed.
+ */
+static bool createEdgesSet(EdgesSet *set, int const numberOfEdges);
+
+/**
+ * @brief Free the memory of the given Edges Set.
+ * @param set A pointer to the Edges Set.
+ */
+static void freeEdgesSet(EdgesSet *set);
+
+/**
+ * @brief Computes the slot of the given Edge in the given Edges Set.
+ * @param set A pointer to the Edges Set.
+ * @param from The index of the declaring File.
+ * @param to The index of the File it depends on.
+ * @return The first slot to look for the Edge in.
+ */
+static int edgeSlot(EdgesSet const *set, int const from, int const to);
+
+/**
+ * @brief Adds the given Edge to the given Edges Set, which must have room for it.
+ * @param set A pointer to the Edges Set.
+ * @param from The index of the declaring File.
+ * @param to The index of the File it depends on.
+ */
+static void addToEdgesSet(EdgesSet *set, int const from, int const to);
+
+/**
+ * @brief Determine if the given Edges Set contains the given Edge.
+ * @param set A pointer to the Edges Set.
+ * @param from The index of the declaring File.
+ * @param to The index of the File it depends on.
+ * @return true if the Edge is in the set, false otherwise.
+ */
+static bool containsEdge(EdgesSet const *set, int const from, int const to);
+
+/**
+ * @brief Rebuilds the Files Table with the given capacity for all the current Files.
+ * @param dependencies The general dependencies array which holds the File structs.
+ * @param capacity The maximal number of Files the table should index.
+ * @return true iff succeed.
+ */
+static bool resizeFilesTable(File * const dependencies, int const capacity);
+
+/**
+ * @brief Runs the program in the Watch Mode. The function keeps the processed data of the given
+ *        input file in the memory, and each time the file is saved it applies only the changed
+ *        lines and prints the updated result.
+ * @param argc The number of given arguments.
+ * @param argv[] The arguments from the user.
+ * @return 0 if the program run ended successfully, -1 if an error occurred.
+ */
+static int runWatchMode(int argc, char *argv[]);
+
+/**
+ * @brief Reads the entire content of the given input file and splits it into lines.
+ * @param path The name or the path of the input file.
+ * @param manifest A pointer to the Manifest to store the content in.
+ * @return true iff succeed.
+ */
+static bool readManifest(char const *path, Manifest *manifest);
+
+/**
+ * @brief Free the memory of a given Manifest.
+ * @param manifest A pointer to the Manifest to free.
+ */
+static void freeManifest(Manifest *manifest);
+
+/**
+ * @brief Makes sure the Watch Mode state has room for the given number of additional Files.
+ * @param state A pointer to the Watch Mode state.
+ * @param additionalFiles The number of Files that may be added.
+ * @return true iff succeed.
+ */
+static bool ensureCapacity(WatchState *state, int const additionalFiles);
+
+/**
+ * @brief Finds the index of the File declared in the given line.
+ * @param line The line to check, it's content is not changed.
+ * @param dependencies The general dependencies array which holds the File structs.
+ * @param create true if a File that does not exist should be created, false otherwise.
+ * @return The index of the declared File, or -1 if the line does not declare an existing File.
+ */
+static int declaredFile(char const *line, File *dependencies, bool const create);
+
+/**
+ * @brief Applies the given new content of the watched file to the Watch Mode state. Only the
+ *        Files declared in the changed lines are processed again, and only the part of the graph
+ *        affected by their dependencies is analyzed. The new content replaces the current one.
+ * @param state A pointer to the Watch Mode state.
+ * @param manifest A pointer to the new content of the watched file.
+ * @return true iff succeed.
+ */
+static bool applyManifest(WatchState *state, Manifest *manifest);
+
+/**
+ * @brief Runs the program in the Out Of Core Mode. The dependencies are spilled to the disk in
+ *        sorted runs which fit the given memory budget, and the cyclic dependency is determined
+ *        by trimming the files which can not be part of a cycle with sequential passes over the
+ *        dependencies, and analyzing the residue in the memory once it fits the budget. Once a
+ *        pass trims only a few dependencies, the residue is analyzed on the disk instead, so a
+ *        deep graph takes a bounded number of passes. The budget counts the Edges and the
+ *        buffers of the streams, while the file names and a few numbers per file are kept in the
+ *        memory regardless of it.
+ * @param argc The number of given arguments.
+ * @param argv[] The arguments from the user.
+ * @return 0 if the program run ended successfully, -1 if an error occurred.
+ */
+static int runOutOfCoreMode(int argc, char *argv[]);
+
+/**
+ * @brief Finds the index of a given file name in the Names Table, and adds it if needed.
+ * @param table A pointer to the Names Table.
+ * @param fileName The file name to find.
+ * @return The index of the file name, or -1 if the allocation failed.
+ */
+static int internName(NamesTable *table, char const *fileName);
+
+/**
+ * @brief Free the memory of a given Names Table.
+ * @param table A pointer to the Names Table to free.
+ */
+static void freeNamesTable(NamesTable *table);
+
+/**
+ * @brief Compares two Edges by their declaring file and then by their dependency file.
+ * @param first A pointer to the first Edge.
+ * @param second A pointer to the second Edge.
+ * @return A negative number, zero or a positive number if the first Edge is smaller, equal or
+ *         greater than the second Edge.
+ */
+static int compareEdges(void const *first, void const *second);
+
+/**
+ * @brief Sorts the given Edges, removes duplicates and appends them as a new run to the file of
+ *        the runs. The end of the new run, in Edges from the start of the file, is added to the
+ *        ends of the runs, and the given Edges are emptied.
+ * @param pRuns The file of the runs.
+ * @param edges The Edges to spill.
+ * @param numberOfEdges A pointer to the number of Edges to spill, set to 0.
+ * @param ends A pointer to the array of the ends of the runs.
+ * @param numberOfRuns A pointer to the number of runs.
+ * @return true iff succeed.
+ */
+static bool spillRun(FILE *pRuns, Edge *edges, int *numberOfEdges, long **ends,
+                     int *numberOfRuns);
+
+/**
+ * @brief Doubles the given buffer of Edges, up to the given maximal size.
+ * @param buffer A pointer to the buffer, which may be NULL.
+ * @param size A pointer to the number of Edges in the buffer.
+ * @param maxSize The maximal number of Edges in the buffer.
+ * @return true iff succeed.
+ */
+static bool growEdgesBuffer(Edge **buffer, int *size, int const maxSize);
+
+/**
+ * @brief Restores the order of a heap of Runs, ordered by their next Edge, from the given
+ *        position downwards.
+ * @param heap The heap of Runs.
+ * @param size The number of Runs in the heap.
+ * @param position The position to start from.
+ */
+static void siftRunDown(Run *heap, int const size, int position);
+
+/**
+ * @brief Makes sure the next Edge of the given Run is in the memory, and reads the following
+ *        Edges of the Run into it's part of the memory if needed, with a single seek.
+ * @param pRuns The file of the runs.
+ * @param pRun A pointer to the Run.
+ * @param valid A pointer to a flag which is set to false if the read failed.
+ * @return true iff the Run has a next Edge.
+ */
+static bool readRun(FILE *pRuns, Run *pRun, bool *valid);
+
+/**
+ * @brief Merges the given consecutive runs into a single sorted run without duplicates, which is
+ *        appended to the given file. The memory is split evenly between the runs.
+ * @param pRuns The file of the runs.
+ * @param start The start of the first run, in Edges from the start of the file.
+ * @param ends The ends of the runs to merge.
+ * @param numberOfRuns The number of runs to merge.
+ * @param pMerged The file to append the merged run to.
+ * @param memory The memory to read the runs into.
+ * @param memorySize The number of Edges in the memory.
+ * @param numberOfEdges A pointer to store the number of Edges in the merged run.
+ * @return true iff succeed.
+ */
+static bool mergeGroup(FILE *pRuns, long const start, long const *ends, int const numberOfRuns,
+                       FILE *pMerged, Edge *memory, int const memorySize, long *numberOfEdges);
+
+/**
+ * @brief Merges the given sorted runs into a single sorted run without duplicates. Each pass
+ *        merges groups of as many runs as the memory holds a stream buffer for, at least two,
+ *        into a new file, so only two temporary files are open at once and each run is read
+ *        through it's own part of the memory. The given file of the runs is closed.
+ * @param pRuns The file of the runs.
+ * @param ends The ends of the runs, in Edges from the start of the file, they are overwritten.
+ * @param numberOfRuns The number of runs to merge.
+ * @param memory The memory to read the runs into.
+ * @param memorySize The number of Edges in the memory.
+ * @param numberOfEdges A pointer to store the number of Edges in the merged run.
+ * @return The file of the merged run, or NULL if an error occurred.
+ */
+static FILE * mergeRuns(FILE *pRuns, long *ends, int numberOfRuns, Edge *memory,
+                        int const memorySize, long *numberOfEdges);
+
+/**
+ * @brief Performs a single trimming pass over the Edges. The files which have no dependencies
+ *        or no dependants among the alive files can not be part of a cycle, so they are marked
+ *        as not alive. The Edges between alive files are written to a new file.
+ * @param pEdges The file of the current Edges, it is closed.
+ * @param alive The alive flag of each file.
+ * @param numberOfFiles The number of files.
+ * @param numberOfEdges A pointer to the number of Edges, updated to the number of Edges left.
+ * @param numberOfTrimmed A pointer to store the number of files trimmed in this pass.
+ * @return The file of the Edges left, or NULL if an error occurred.
+ */
+static FILE * trimEdges(FILE *pEdges, bool *alive, int const numberOfFiles, long *numberOfEdges,
+                        int *numberOfTrimmed);
+
+/**
+ * @brief Analyze the Edges between the alive files in the memory. The Edges are expected to be
+ *        sorted by their declaring file.
+ * @param pEdges The file of the Edges.
+ * @param alive The alive flag of each file.
+ * @param numberOfFiles The number of files.
+ * @param numberOfEdges The number of Edges in the file.
+ * @param valid A pointer to a flag which is set to false if the allocation failed.
+ * @return true if there is a cyclic dependency, false otherwise.
+ */
+static bool analyzeResidue(FILE *pEdges, bool * const alive, int const numberOfFiles,
+                           long const numberOfEdges, bool *valid);
+
+/**
+ * @brief Analyze the Edges between the alive files which do not fit the memory, by removing
+ *        the files without alive dependants one after the other (Kahn's Algorithm). Only a few
+ *        numbers per file are kept in the memory: a sequential pass finds where the Edges of each
+ *        file start, and a removed file reads it's own Edges with a single seek. So the whole
+ *        file is read about once more, however deep the graph is. The Edges are expected to be
+ *        sorted by their declaring file.
+ * @param pEdges The file of the Edges.
+ * @param alive The alive flag of each file.
+ * @param numberOfFiles The number of files.
+ * @param valid A pointer to a flag which is set to false if the allocation or a read failed.
+ * @return true if there is a cyclic dependency, false otherwise.
+ */
+static bool peelResidue(FILE *pEdges, bool * const alive, int const numberOfFiles,
+                        bool *valid);
+
+/**
+ * @brief Process the entire input file with the given name into a new dependencies array.
+ *        It is the caller's responsibility to free the returned array and the Files Table.
+ * @param fileName The name or the path of the input file.
+ * @return The general dependencies array which holds the File structs, or NULL if the input file
+ *         is invalid or the allocation failed.
+ */
+static File * loadDependencies(char const *fileName);
+
+/**
+ * @brief Finds the strongly connected Components of the graph of the Files (Tarjan's Algorithm).
+ *        The Components are numbered in reverse topological order, i.e. a File may only depend
+ *        on Files in a Component with the same or a smaller number.
+ * @param dependencies The general dependencies array which holds the File structs.
+ * @param component An array to store the Component number of each File.
+ * @return The number of Components, or -1 if the allocation failed.
+ */
+static int findComponents(File * const dependencies, int *component);
+
+/**
+ * @brief Resizes the given array of integers to the given number of integers.
+ * @param pArray A pointer to the array, which is kept if the allocation failed.
+ * @param capacity The number of integers.
+ * @return true iff succeed.
+ */
+static bool resizeIntegers(int **pArray, int const capacity);
+
+/**
+ * @brief Makes sure the given Components have room for the given number of Files. The new Files
+ *        are not on a cycle, and their Component numbers are not set.
+ * @param components A pointer to the Components.
+ * @param capacity The number of Files.
+ * @return true iff succeed.
+ */
+static bool reserveComponents(Components *components, int const capacity);
+
+/**
+ * @brief Free the memory of the given Components.
+ * @param components A pointer to the Components.
+ */
+static void freeComponents(Components *components);
+
+/**
+ * @brief Finds again the strongly connected Components of the Files which are reachable from the
+ *        given roots (Tarjan's Algorithm), and whether each of them is on a cycle.
+ * @param dependencies The general dependencies array which holds the File structs.
+ * @param components A pointer to the Components, with room for all the Files.
+ * @param roots The indices of the Files to start from, or NULL for the first numberOfRoots Files.
+ * @param numberOfRoots The number of roots.
+ * @param withinComponents true if the search should not leave the current Component of a root.
+ */
+static void searchComponents(File * const dependencies, Components *components,
+                             int const *roots, int const numberOfRoots,
+                             bool const withinComponents);
+
+/**
+ * @brief Determine if the target File is reachable from the source File without leaving their
+ *        Component.
+ * @param dependencies The general dependencies array which holds the File structs.
+ * @param components A pointer to the Components, with room for all the Files.
+ * @param sourceIndex The index of the File to start the search from.
+ * @param targetIndex The index of the File to search for, in the Component of the source File.
+ * @return true if the target File is reachable, false otherwise.
+ */
+static bool reachesFile(File * const dependencies, Components *components, int const sourceIndex,
+                        int const targetIndex);
+
+/**
+ * @brief Runs the program in the Feedback Mode. For each group of Files with cyclic dependencies
+ *        the function suggests a small set of dependencies, ranked, whose removal breaks all the
+ *        cycles in the group.
+ * @param argc The number of given arguments.
+ * @param argv[] The arguments from the user.
+ * @return 0 if the program run ended successfully, -1 if an error occurred.
+ */
+static int runFeedbackMode(int argc, char *argv[]);
+
+/**
+ * @brief Orders the Files of the cyclic Components so that few dependencies go backwards
+ *        (Eades-Lin-Smyth heuristic, linear time). Only dependencies inside a Component are
+ *        considered, the dependencies that go backwards form a feedback set of the Component.
+ * @param dependencies The general dependencies array which holds the File structs.
+ * @param component The Component number of each File.
+ * @param cyclic Whether each File is in a Component with a cycle.
+ * @param position An array to store the position of each cyclic File in the ordering.
+ * @return true iff succeed.
+ */
+static bool orderFiles(File * const dependencies, int * const component, bool * const cyclic,
+                       int *position);
+
+/**
+ * @brief Compares two suggested dependencies by their Component and then by their rank.
+ * @param first A pointer to the first FeedbackEdge.
+ * @param second A pointer to the second FeedbackEdge.
+ * @return A negative number, zero or a positive number if the first FeedbackEdge should be
+ *         printed before, together with or after the second FeedbackEdge.
+ */
+static int compareFeedbackEdges(void const *first, void const *second);
+
+/**
+ * @brief Runs the program in the Closure Mode. The function computes for each File the set of
+ *        all the Files it depends on transitively, reports the size of the closure and the time
+ *        it took, and prints the set of each queried file name.
+ * @param argc The number of given arguments.
+ * @param argv[] The arguments from the user.
+ * @return 0 if the program run ended successfully, -1 if an error occurred.
+ */
+static int runClosureMode(int argc, char *argv[]);
+
+/**
+ * @brief Computes the transitive closure of the graph of the Components. Each Component has a
+ *        row of bits, bit d is set iff a File of Component d is reachable from the Component by
+ *        at least one dependency. The rows are computed in reverse topological order, so each
+ *        row is the union of the rows it depends on, which are already computed.
+ * @param dependencies The general dependencies array which holds the File structs.
+ * @param component The Component number of each File.
+ * @param numberOfComponents The number of Components.
+ * @param members The Files of each Component, grouped by Component.
+ * @param membersOffsets The Files of Component c are between offsets c and c + 1 in members.
+ * @param closure The rows of the closure, all bits are expected to be zero.
+ * @param rowWords The number of words in each row.
+ * @return true iff succeed, false if the allocation failed.
+ */
+static bool computeClosure(File * const dependencies, int * const component,
+                           int const numberOfComponents, int * const members,
+                           int * const membersOffsets, uint64_t *closure, int const rowWords);
+
+/**
+ * @brief Sets each word of the destination to the bitwise or of it and the matching word of the
+ *        source. The loop has no dependencies between words, so with -ftree-vectorize, which the
+ *        Makefile passes for this file, it is vectorized.
+ * @param destination The destination words.
+ * @param source The source words.
+ * @param numberOfWords The number of words.
+ */
+static void orWords(uint64_t * restrict destination, uint64_t const * restrict source,
+                    int const numberOfWords);
+
+/**
+ * @brief Counts the bits which are set in a given word.
+ * @param word The word to count.
+ * @return The number of bits which are set.
+ */
+static int countBits(uint64_t word);
+
+
+/*-----=  Global Variables  =-----*/
+
+
+int gNumberOfFiles = NO_FILES;
+
+int *gFilesTable = NULL;
+
+int gFilesTableSize = NO_FILES;
+
+
+/*-----=  Statistics  =-----*/
+
+
+#ifdef STATS
+/**
+ * The Stats of the program.
+ */
+static Stats gStats;
+
+/**
+ * The names of the counted functions in the Stats output, in the order of CountedFunction.
+ */
+static char const * const gCountedFunctionNames[NUMBER_OF_COUNTED_FUNCTIONS] = {
+    "processLine", "containsFile", "addNewFile", "addNewDependency", "dfs", "reachesFile",
+    "searchComponents", "internName"
+};
+
+/**
+ * @brief Allocates memory with malloc and counts it in the Stats. The size is kept in a header
+ *        right before the memory, so countedFree and countedRealloc know how many bytes it holds.
+ * @param size The number of bytes.
+ * @return A pointer to the memory, or NULL if the allocation failed.
+ */
+static void * countedMalloc(size_t const size)
+{
+    AllocationHeader *pHeader = (AllocationHeader *)malloc(sizeof(AllocationHeader) + size);
+    if (pHeader == NULL)
+    {
+        return NULL;
+    }
+    pHeader -> size = size;
+    STATS_ADD(allocations, 1);
+    if (STATS_ADD(bytes, (long)size) > gStats.peakBytes)
+    {
+        gStats.peakBytes = gStats.bytes;
+    }
+    return pHeader + 1;
+}
+
+/**
+ * @brief Allocates zeroed memory and counts it in the Stats.
+ * @param count The number of elements.
+ * @param size The number of bytes of each element.
+ * @return A pointer to the memory, or NULL if the allocation failed.
+ */
+static void * countedCalloc(size_t const count, size_t const size)
+{
+    void *pMemory = countedMalloc(count * size);
+    if (pMemory != NULL)
+    {
+        memset(pMemory, 0, count * size);
+    }
+    return pMemory;
+}
+
+/**
+ * @brief Frees memory allocated by the counted functions and counts it in the Stats.
+ * @param pMemory A pointer to the memory, or NULL.
+ */
+static void countedFree(void *pMemory)
+{
+    if (pMemory != NULL)
+    {
+        AllocationHeader *pHeader = (AllocationHeader *)pMemory - 1;
+        STATS_ADD(frees, 1);
+        STATS_ADD(bytes, -(long)(pHeader -> size));
+        free(pHeader);
+    }
+    return;
+}
+
+/**
+ * @brief Reallocates memory allocated by the counted functions and counts it in the Stats, as an
+ *        allocation of the new memory and a free of the old one.
+ * @param pMemory A pointer to the memory, or NULL.
+ * @param size The new number of bytes.
+ * @return A pointer to the memory, or NULL if the allocation failed and the old memory is kept.
+ */
+static void * countedRealloc(void *pMemory, size_t const size)
+{
+    if (pMemory == NULL)
+    {
+        return countedMalloc(size);
+    }
+    AllocationHeader *pHeader = (AllocationHeader *)pMemory - 1;
+    size_t const oldSize = pHeader -> size;
+    pHeader = (AllocationHeader *)realloc(pHeader, sizeof(AllocationHeader) + size);
+    if (pHeader == NULL)
+    {
+        return NULL;
+    }
+    pHeader -> size = size;
+    STATS_ADD(allocations, 1);
+    STATS_ADD(frees, 1);
+    if (STATS_ADD(bytes, (long)size - (long)oldSize) > gStats.peakBytes)
+    {
+        gStats.peakBytes = gStats.bytes;
+    }
+    return pHeader + 1;
+}
+
+/**
+ * @brief Compares strings with strcmp and counts it in the Stats.
+ * @param first The first string.
+ * @param second The second string.
+ * @return The result of strcmp.
+ */
+static int countedStrcmp(char const *first, char const *second)
+{
+    STATS_ADD(comparisons, 1);
+    return strcmp(first, second);
+}
+
+/**
+ * @brief Prints the Stats to the standard error, when the program exits.
+ */
+static void printStats()
+{
+    fprintf(stderr, STATS_OUTPUT, "allocations", gStats.allocations);
+    fprintf(stderr, STATS_OUTPUT, "frees", gStats.frees);
+    fprintf(stderr, STATS_OUTPUT, "bytes", gStats.bytes);
+    fprintf(stderr, STATS_OUTPUT, "peakBytes", gStats.peakBytes);
+    fprintf(stderr, STATS_OUTPUT, "comparisons", gStats.comparisons);
+    int i = 0;
+    while (i < NUMBER_OF_COUNTED_FUNCTIONS)
+    {
+        fprintf(stderr, STATS_OUTPUT, gCountedFunctionNames[i], gStats.calls[i]);
+        i++;
+    }
+    return;
+}
+
+// From here on, the program allocates, frees and compares strings through the counted functions.
+#define malloc(size) countedMalloc(size)
+#define calloc(count, size) countedCalloc(count, size)
+#define realloc(pMemory, size) countedRealloc(pMemory, size)
+#define free(pMemory) countedFree(pMemory)
+#define strcmp(first, second) countedStrcmp(first, second)
+#endif
+
+
+/*-----=  Main  =-----*/
+
+
+/**
+ * @brief The main function that runs the program.
+ *        The function receive file path as input from the user, and analyze the file's data.
+ *        If the user input is invalid, the program ends and return -1;
+ *        The function determine if there is a cyclic dependency in the given file or not,
+ *        and prints an informative message to the standard output.
+ * @param argc The number of given arguments.
+ * @param argv[] The arguments from the user.
+ * @return 0 if the program run ended successfully, -1 if an error occurred.
+ */
+int main(int argc, char *argv[])
+{
+#ifdef STATS
+    atexit(printStats);
+#endif
+    if ((argc > MODE_FLAG_INDEX) &&
+        (strcmp(argv[MODE_FLAG_INDEX], DIFF_MODE_FLAG) == STRING_EQUALITY))
+    {
+        return runDiffMode(argc, argv);
+    }
+    if ((argc > MODE_FLAG_INDEX) &&
+        (strcmp(argv[MODE_FLAG_INDEX], WATCH_MODE_FLAG) == STRING_EQUALITY))
+    {
+        return runWatchMode(argc, argv);
+    }
+    if ((argc > MODE_FLAG_INDEX) &&
+        (strcmp(argv[MODE_FLAG_INDEX], OUT_OF_CORE_MODE_FLAG) == STRING_EQUALITY))
+    {
+        return runOutOfCoreMode(argc, argv);
+    }
+    if ((argc > MODE_FLAG_INDEX) &&
+        (strcmp(argv[MODE_FLAG_INDEX], FEEDBACK_MODE_FLAG) == STRING_EQUALITY))
+    {
+        return runFeedbackMode(argc, argv);
+    }
+    if ((argc > MODE_FLAG_INDEX) &&
+        (strcmp(argv[MODE_FLAG_INDEX], CLOSURE_MODE_FLAG) == STRING_EQUALITY))
+    {
+        return runClosureMode(argc, argv);
+    }
+
+    FILE * pFile = handleInput(argc, argv);
+
+    if (pFile == NULL)
+    {
+        return INVALID_STATE;
+    }
+    else
+    {
+        File *dependencies = NULL;
+
+        // An estimate number of files, not accurate but it's used only to serve the memory
+        // allocation for 'dependencies'.
+        int const countEstimate = estimateFilesCount(pFile);
+        assert(countEstimate >= NO_FILES);
+        dependencies = (File *)malloc(countEstimate * sizeof(File));
+        if (!(createFilesTable(countEstimate)))
+        {
+            free(dependencies);
+            fclose(pFile);
+            return INVALID_STATE;
+        }
+
+        // Process the data of the file and close it's stream.
+        processFile(pFile, dependencies);
+        fclose(pFile);
+
+        // Determine if there is Cyclic Dependency, and free all allocated memory.
+        bool const result = analyzeData(dependencies);
+        analyzeResult(result);
+
+        // Free Memory.
+        freeAllFiles(dependencies);
+        free(dependencies);
+        freeFilesTable();
+
+        return VALID_STATE;
+    }
+}
+
+
+/*-----=  Analyze Input File  =-----*/
+
+
+/**
+ * @brief An estimate count for the number of files appears in the input file to read from.
+ *        This is only an estimation and some files could be counted more then once.
+ * @param pFile The input file containing the data.
+ * @return The estimate count number of files.
+ */
+static int estimateFilesCount(FILE * const pFile)
+{
+    assert(pFile != NULL);
+    int counter = NO_FILES;
+    char currentLine[MAX_LINE_SIZE] = {};
+    while (fgets(currentLine, MAX_LINE_SIZE, pFile) != NULL)
+    {
+        counter++;  // A new line declare a new file (not always but it is an estimate count).
+        int numberOfDependencies = countDependencies(currentLine);
+        counter += numberOfDependencies;
+    }
+    rewind(pFile);  // Resets the file to the beginning for the next functions use.
+    return counter;
+}
+
+/**
+ * @brief Perform the first analysis of the input file. The function parse each line into the
+ *        desired tokens. It process the data and create the proper File structs with the
+ *        processed data, and store it in the general dependencies array.
+ *        The function also analyze the File's dependencies and updates them properly.
+ *        By the end of this function run, we have created a File struct for each file we have
+ *        encountered, and each one of this File structs stores it's dependencies as desired.
+ * @param pFile The input file to read.
+ * @param dependencies The general dependencies array which holds the File structs.
+ */
+static void processFile(FILE * const pFile, File *dependencies)
+{
+    // The current line read from the input file.
+    char currentLine[MAX_LINE_SIZE] = {};
+
+    // Analyzing each line in the file.
+    while (fgets(currentLine, MAX_LINE_SIZE, pFile) != NULL)
+    {
+        processLine(currentLine, dependencies);
+    }
+    return;
+}
+
+/**
+ * @brief Process a single line of the input file. The function creates the File structs of the
+ *        file declared in the line and of it's dependencies if they do not exist already, and adds
+ *        the dependencies to the declared File.
+ * @param currentLine The line to process, it's content is changed during the process.
+ * @param dependencies The general dependencies array which holds the File structs.
+ */
+static void processLine(char *currentLine, File *dependencies)
+{
+    STATS_CALL(PROCESS_LINE_CALL);
+    // Each new line we initialize these variables which helps us with processing the line.
+    char currentLineCopy[MAX_LINE_SIZE] = {};
+    File *currentFile = NULL;
+    char *fileName = NULL;
+    char *fileDependency = NULL;
+    int index = START_INDEX;
+
+    // Count the number of dependencies in this current line.
+    // We copy the current line in order to perform manipulations on it without changing it.
+    strcpy(currentLineCopy, currentLine);
+    int const numberOfDependencies = countDependencies(currentLineCopy);
+    assert(numberOfDependencies >= NO_DEPENDENCIES);
+
+    // File name process, a line without a file name declares nothing.
+    fileName = strtok(currentLine, FILE_NAME_DELIMITER);
+    if (fileName == NULL)
+    {
+        return;
+    }
+    // Determine if the current file is already exists in the dependencies array.
+    // If the file does not exist, we create a new File struct and store it in the
+    // dependencies array.
+    // If the file exists, we find it in the dependencies array and update it's current number
+    // of dependencies.
+    int currentFileIndex = containsFile(fileName, dependencies);
+    if (currentFileIndex == FILE_NOT_FOUND)
+    {
+        currentFileIndex = addNewFile(fileName, dependencies, numberOfDependencies);
+        currentFile = &(dependencies[currentFileIndex]);
+    }
+    else
+    {
+        currentFile = &(dependencies[currentFileIndex]);
+        assert(currentFile != NULL);
+        assert(currentFile -> numberOfDependencies >= NO_DEPENDENCIES);
+        index = currentFile -> numberOfDependencies;
+        updateExistingFile(currentFile, numberOfDependencies);
+    }
+
+    // File's dependencies process.
+    fileDependency = strtok(NULL, FIRST_DEPENDENCY_DELIMITER);
+    while (fileDependency != NULL)
+    {
+        // If we encountered a file which does not exists already, we create for it a new
+        // File struct and store it in the dependencies array.
+        int currentDependencyIndex = containsFile(fileDependency, dependencies);
+        if (currentDependencyIndex == FILE_NOT_FOUND)
+        {
+            currentDependencyIndex = addNewFile(fileDependency, dependencies, NO_DEPENDENCIES);
+        }
+
+        // Assign the index of the file from the general dependencies array into the current
+        // file's dependencies.
+        addNewDependency(currentFile, currentDependencyIndex, &index);
+
+        fileDependency = strtok(NULL, DEPENDENCY_DELIMITER);
+    }
+    return;
+}
+
+/**
+ * @brief Analyze the data that has been processed from the input file.
+ *        Using the DFS Algorithm, this function determines if there is a cyclic dependency
+ *        or not.
+ * @param dependencies The general dependencies array which holds the File structs.
+ * @return true if there is a cyclic dependency, false otherwise.
+ */
+static bool analyzeData(File * const dependencies)
+{
+    File *currentFile = NULL;
+    File *visited = NULL;
+    visited = (File *)malloc(gNumberOfFiles * sizeof(File));
+    assert(visited != NULL);
+    int visitedIndex = START_INDEX - 1;
+
+    int i;
+    for (i = 0 ; i < gNumberOfFiles; i++)
+    {
         currentFile = &dependencies[i];
         int currentIndex = START_INDEX - 1;
         File *currentDependencies = NULL;
         currentDependencies = (File *)malloc(gNumberOfFiles * sizeof(File));
         assert(currentDependencies != NULL);
 
-        // Run DFS Algorithm.
-        if (dfs(currentFile, dependencies, currentDependencies, visited, &currentIndex))
+        // Run DFS Algorithm.
+        if (dfs(currentFile, dependencies, currentDependencies, visited, &currentIndex,
+                &visitedIndex))
+        {
+            free(currentDependencies);
+            free(visited);
+            return true;
+        }
+
+        free(currentDependencies);
+
+    }
+    free(visited);
+    return false;
+}
+
+/**
+ * @brief Runs a DFS Algorithm on a given file.
+ * @param currentFile The pointer for the current file to run DFS on.
+ * @param dependencies The general dependencies array which holds the File structs.
+ * @param currentDependencies The currently visited files.
+ * @param visited All the files that were absolutely visited during the entire program run,
+ *        i.e. a file in this array is a file which was visited and also all of its neighbours
+ *        were visited.
+ * @param currentIndex The current available index in the currentDependencies array.
+ * @param visitedIndex The last occupied index in the visited array.
+ * @return true if there is a cyclic dependency, false otherwise.
+ */
+static bool dfs(File * const currentFile, File * const dependencies, File *currentDependencies,
+                File *visited, int *currentIndex, int *visitedIndex)
+{
+    STATS_CALL(DFS_CALL);
+    assert(currentFile != NULL);
+    assert(dependencies != NULL);
+    assert(visited != NULL);
+    assert(currentIndex != NULL);
+    assert(visitedIndex != NULL);
+
+    File *fileDependency = NULL;
+
+    int i;
+    for (i = 0 ; i < (currentFile -> numberOfDependencies); i++)
+    {
+        // Assigning the next dependency of currentFile.
+        fileDependency = &(dependencies[currentFile -> fileDependencies[i]]);
+        char *fileName = fileDependency -> fileName;
+
+        assert(fileName != NULL);
+        // In case the dependency file has already been fully visited, i.e. we visited it and all
+        // of it's neighbours, we can ignore it and skip to the next dependency file.
+        if (dfsContains(fileName, visited, *visitedIndex))
+        {
+            continue;
+        }
+        // In case dependency file is in the current dependencies array, it means we found a cycle.
+        else if (dfsContains(fileName, currentDependencies, *currentIndex))
+        {
+            return true;
+        }
+        // Otherwise, we add the current dependency file to the current dependencies array.
+        else
+        {
+            assert(fileDependency != NULL);
+            currentDependencies[++(*currentIndex)] = *fileDependency;
+        }
+
+        // We recursively call for DFS with the current dependency file.
+        if (dfs(fileDependency, dependencies, currentDependencies, visited, currentIndex,
+                visitedIndex))
+        {
+            return true;
+        }
+    }
+
+    // After visiting all of currentFile neighbours, we add it to the visited array if needed.
+    assert((currentFile -> fileName) != NULL);
+    if (!(dfsContains(currentFile -> fileName, visited, *visitedIndex)))
+    {
+        visited[++(*visitedIndex)] = *currentFile;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Determine if the given file name appears in the given dependencies array.
+ *        This function used in the DFS Algorithm.
+ * @param fileName The file name to check.
+ * @param dependencies The array to check in.
+ * @param count The current amount of files in the dependencies.
+ * @return true if there is a cyclic dependency, false otherwise.
+ */
+static bool dfsContains(char const *fileName, File * const dependencies, int count)
+{
+    assert(fileName != NULL);
+    assert(dependencies != NULL);
+
+    while (count >= START_INDEX)
+    {
+        assert(dependencies[count].fileName != NULL);
+        if (strcmp(dependencies[count].fileName, fileName) == STRING_EQUALITY)
+        {
+            return true;
+        }
+        count--;
+    }
+    return false;
+}
+
+/**
+ * @brief With the given results from the analysis process, this function perform the required
+ *        actions in each scenario (cyclic or no cyclic dependency).
+ * @param result A boolean variable holding the result from the analysis process.
+ */
+static void analyzeResult(bool const result)
+{
+    if (result)
+    {
+        printf(DEPENDENCY_MESSAGE);
+    }
+    else
+    {
+        printf(NO_DEPENDENCY_MESSAGE);
+    }
+}
+
+
+/*-----=  Input Handling  =-----*/
+
+
+/**
+ * @brief Handles the entire process of receiving the input from the user and process it.
+ *        The function verifies a valid number of arguments, and that the given arguments are
+ *        valid as well (i.e. valid input file).
+ *        The function returns a pointer to the input file which was as an argument.
+ * @param argc The number of given arguments.
+ * @param argv[] The arguments from the user.
+ * @return A pointer to the input file which was as an argument if the input is valid,
+ *         otherwise returns NULL pointer.
+ */
+static FILE * handleInput(int argc, char *argv[])
+{
+    // Check valid arguments.
+    if (argc != VALID_ARGUMENTS_NUMBER)
+    {
+        fprintf(stderr, INVALID_ARGUMENTS_MESSAGE);
+        return NULL;
+    }
+    else
+    {
+        // Receive the File to check.
+        FILE *pFile = NULL;
+        pFile = fopen(argv[FILE_NAME_INDEX], READ_MODE);
+
+        // In case of bad file.
+        if (pFile == NULL)
+        {
+            fprintf(stderr, INVALID_FILE_ARGUMENTS_MESSAGE, argv[FILE_NAME_INDEX]);
+        }
+
+        return pFile;
+    }
+}
+
+
+/*-----=  File Struct Handling  =-----*/
+
+
+/**
+ * @brief Free the memory of a given File.
+ * @param file The File to free it's memory.
+ */
+static void freeFile(File *file)
+{
+    if (file != NULL)
+    {
+        free(file -> fileName);
+        file -> fileName = NULL;
+    }
+    return;
+}
+
+/**
+ * @brief Free the memory of given several Files.
+ * @param dependencies The pointer to the Files to free.
+ */
+static void freeAllFiles(File * const dependencies)
+{
+    if (dependencies != NULL)
+    {
+        int i;
+        for (i = 0 ; i < gNumberOfFiles; i++)
+        {
+            freeFile(&dependencies[i]);
+        }
+    }
+    return;
+}
+
+/**
+ * @brief Initialize a given File struct with the desired parameters.
+ * @param file A pointer to the File struct to initialize.
+ * @param fileName The name of the File.
+ * @param numberOfDependencies The number of dependencies of the given File.
+ * @return true iff succeed.
+ */
+static bool initializeFile(File *file, char const *fileName, int const numberOfDependencies)
+{
+    assert(file != NULL);
+    assert(fileName != NULL);
+    assert(numberOfDependencies >= NO_DEPENDENCIES);
+
+    // Initialize File Name.
+    file -> fileName = (char *)malloc(strlen(fileName) + STRING_TERMINATOR_COUNT);
+    if (file -> fileName == NULL)
+    {
+        return false;
+    }
+    memcpy(file -> fileName, fileName, strlen(fileName) + STRING_TERMINATOR_COUNT);
+
+    // Initialize File Dependency.
+    file -> numberOfDependencies = numberOfDependencies;
+    return true;
+}
+
+/**
+ * @brief Counts the amount of dependencies of a file in a given line.
+ * @param currentLine The current line to check.
+ * @return The number of dependencies the file in the given line has.
+ */
+static int countDependencies(char *currentLine)
+{
+    assert(currentLine != NULL);
+    char *fileDependency = NULL;
+    int numberOfDependencies = NO_DEPENDENCIES;
+    strtok(currentLine, FILE_NAME_DELIMITER);  // Skip the file's name token.
+
+    fileDependency = strtok(NULL, FIRST_DEPENDENCY_DELIMITER);
+    while (fileDependency != NULL)
+    {
+        // Only if after the ',' delimiter appears a valid name, we update the dependencies number.
+        if (isalpha(fileDependency[START_INDEX]) || isdigit(fileDependency[START_INDEX]))
+        {
+            numberOfDependencies++;
+        }
+        fileDependency = strtok(NULL, DEPENDENCY_DELIMITER);
+    }
+
+    return numberOfDependencies;
+}
+
+/**
+ * @brief Creating and adding a new File struct instance to the general dependencies array.
+ * @param fileName The file name for the File struct.
+ * @param dependencies The general dependencies array which stores the Files.
+ * @param numberOfDependencies The number of dependencies of the new File.
+ * @return The index of the new File in the dependencies array.
+ */
+static int addNewFile(char const *fileName, File dependencies[], int const numberOfDependencies)
+{
+    STATS_CALL(ADD_NEW_FILE_CALL);
+    // The last index in the dependencies array which contains a File struct.
+    static int lastFileIndex = START_INDEX;
+
+    // Initialize the File struct.
+    File file = {NULL, {FILE_NOT_FOUND}, NO_DEPENDENCIES};
+    initializeFile(&file, fileName, numberOfDependencies);
+
+    // Insert the new File struct to the proper place in the dependencies array.
+    assert(dependencies != NULL);
+    dependencies[lastFileIndex] = file;
+    addToFilesTable(file.fileName, lastFileIndex);
+    gNumberOfFiles++;
+    return lastFileIndex++;
+}
+
+/**
+ * @brief Updates a given File with new number of dependencies and allocating new memory for it's
+ *        dependencies.
+ * @param file The File to update.
+ * @param numberOfDependencies The number of dependencies to add to the current count.
+ */
+static void updateExistingFile(File *file, int const numberOfDependencies)
+{
+    // Updating the File's data.
+    assert(file != NULL);
+    file -> numberOfDependencies += numberOfDependencies;
+}
+
+/**
+ * @brief Adds new dependency to a given File if it does not exists already. The new dependency is
+ *        represented as an integer, which states the index of it in the general dependencies
+ *        array.
+ * @param file A pointer to the File we are about to update.
+ * @param fileIndex The file index representing the new dependency file.
+ * @param indexToStore The current available index by order in the File's dependencies
+ *                     array to insert the new dependency.
+ * @param index The first index not occupied in the file dependencies array.
+ */
+static void addNewDependency(File *file, int const fileIndex, int *indexToStore)
+{
+    STATS_CALL(ADD_NEW_DEPENDENCY_CALL);
+    assert(file != NULL);
+    if (!(containsDependency(file, fileIndex, *indexToStore)))
+    {
+        assert(file -> fileDependencies != NULL);
+        file -> fileDependencies[*indexToStore] = fileIndex;
+        (*indexToStore)++;
+    }
+    else
+    {
+        // If the dependency is already exists, it was counted twice so we need to update properly.
+        assert((file -> numberOfDependencies) >= NO_DEPENDENCIES);
+        file -> numberOfDependencies--;
+    }
+    return;
+}
+
+/**
+ * @brief Determine if a given dependency file index has already exists as a dependency of the
+ *        given file pointer.
+ * @param file A pointer to the File contains dependencies.
+ * @param fileIndex The file index representing the dependency file.
+ * @param index The first index not occupied in the file dependencies array.
+ * @return true if the dependency file exists, false otherwise.
+ */
+static bool containsDependency(File * const file, int const fileIndex, int const index)
+{
+    assert(file != NULL);
+
+    int i;
+    for (i = 0; i < index; i++)
+    {
+        if ((file -> fileDependencies)[i] == fileIndex)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Determine if a given file name has already appears in the File's dependencies array.
+ *        If the file exists, the function returns it's index in the array, otherwise the function
+ *        returns -1
+ *        The lookup is done through the Files Table, so it does not depend on the number of Files.
+ * @param fileName The file name to check.
+ * @param dependencies The array which contains the existing Files.
+ * @return The index of the given file name in the array if exists, otherwise returns -1.
+ */
+static int containsFile(char const *fileName, File * const dependencies)
+{
+    STATS_CALL(CONTAINS_FILE_CALL);
+    assert(fileName != NULL);
+    assert(dependencies != NULL);
+    assert(gFilesTable != NULL);
+
+    int slot = hashFileName(fileName) & (gFilesTableSize - 1);
+    while (gFilesTable[slot] != EMPTY_SLOT)
+    {
+        int const i = gFilesTable[slot];
+        assert(dependencies[i].fileName != NULL);
+        if (strcmp(dependencies[i].fileName, fileName) == STRING_EQUALITY)
+        {
+            return i;
+        }
+        slot = (slot + 1) & (gFilesTableSize - 1);
+    }
+    return FILE_NOT_FOUND;
+}
+
+
+/*-----=  Files Table  =-----*/
+
+
+/**
+ * @brief Computes the hash value of a given file name (djb2).
+ * @param fileName The file name to hash.
+ * @return The hash value of the file name.
+ */
+static unsigned int hashFileName(char const *fileName)
+{
+    assert(fileName != NULL);
+    unsigned int hash = HASH_INITIAL_VALUE;
+    while (*fileName != '\0')
+    {
+        hash = ((hash << HASH_SHIFT) + hash) + (unsigned char)(*fileName);
+        fileName++;
+    }
+    return hash;
+}
+
+/**
+ * @brief Allocates the Files Table, which maps a file name to it's index in the general
+ *        dependencies array, for the given number of Files.
+ * @param capacity The maximal number of Files the table should index.
+ * @return true iff succeed.
+ */
+static bool createFilesTable(int const capacity)
+{
+    assert(capacity >= NO_FILES);
+
+    // The size is a power of two so a slot is found by masking the hash value.
+    gFilesTableSize = 1;
+    while (gFilesTableSize < (capacity * FILES_TABLE_LOAD_FACTOR))
+    {
+        gFilesTableSize <<= 1;
+    }
+
+    gFilesTable = (int *)malloc(gFilesTableSize * sizeof(int));
+    if (gFilesTable == NULL)
+    {
+        gFilesTableSize = NO_FILES;
+        return false;
+    }
+    memset(gFilesTable, EMPTY_SLOT, gFilesTableSize * sizeof(int));  // All bytes set means -1.
+    return true;
+}
+
+/**
+ * @brief Free the memory of the Files Table.
+ */
+static void freeFilesTable()
+{
+    free(gFilesTable);
+    gFilesTable = NULL;
+    gFilesTableSize = NO_FILES;
+    return;
+}
+
+/**
+ * @brief Adds the File in the given index of the general dependencies array to the Files Table.
+ * @param fileName The name of the File to add.
+ * @param fileIndex The index of the File in the general dependencies array.
+ */
+static void addToFilesTable(char const *fileName, int const fileIndex)
+{
+    assert(fileName != NULL);
+    assert(gFilesTable != NULL);
+    assert(gNumberOfFiles < gFilesTableSize);
+
+    int slot = hashFileName(fileName) & (gFilesTableSize - 1);
+    while (gFilesTable[slot] != EMPTY_SLOT)
+    {
+        slot = (slot + 1) & (gFilesTableSize - 1);
+    }
+    gFilesTable[slot] = fileIndex;
+    return;
+}
+
+
+/*-----=  Diff Mode  =-----*/
+
+
+/**
+ * @brief Runs the program in the Diff Mode. The function parses both of the given input files
+ *        into a shared name space, and reports only the cyclic dependencies which were
+ *        introduced by the new input file relative to the old one.
+ * @param argc The number of given arguments.
+ * @param argv[] The arguments from the user.
+ * @return 0 if the program run ended successfully, -1 if an error occurred.
+ */
+static int runDiffMode(int argc, char *argv[])
+{
+    if (argc != DIFF_ARGUMENTS_NUMBER)
+    {
+        fprintf(stderr, INVALID_DIFF_ARGUMENTS_MESSAGE);
+        return INVALID_STATE;
+    }
+
+    FILE *pOldFile = fopen(argv[OLD_FILE_NAME_INDEX], READ_MODE);
+    if (pOldFile == NULL)
+    {
+        fprintf(stderr, INVALID_FILE_ARGUMENTS_MESSAGE, argv[OLD_FILE_NAME_INDEX]);
+        return INVALID_STATE;
+    }
+    FILE *pNewFile = fopen(argv[NEW_FILE_NAME_INDEX], READ_MODE);
+    if (pNewFile == NULL)
+    {
+        fprintf(stderr, INVALID_FILE_ARGUMENTS_MESSAGE, argv[NEW_FILE_NAME_INDEX]);
+        fclose(pOldFile);
+        return INVALID_STATE;
+    }
+
+    // Both input files share the same dependencies array, so a file name has the same index in
+    // the old and in the new dependencies.
+    int const countEstimate = estimateFilesCount(pOldFile) + estimateFilesCount(pNewFile);
+    assert(countEstimate >= NO_FILES);
+    File *dependencies = (File *)malloc(countEstimate * sizeof(File));
+    if ((dependencies == NULL && countEstimate > NO_FILES) || !(createFilesTable(countEstimate)))
+    {
+        free(dependencies);
+        fclose(pOldFile);
+        fclose(pNewFile);
+        return INVALID_STATE;
+    }
+
+    // Process the old file and keep the set of it's dependencies.
+    processFile(pOldFile, dependencies);
+    fclose(pOldFile);
+    int numberOfOldEdges = NO_DEPENDENCIES;
+    int i;
+    for (i = 0; i < gNumberOfFiles; i++)
+    {
+        numberOfOldEdges += dependencies[i].numberOfDependencies;
+    }
+    EdgesSet oldEdges = {NULL, NO_FILES};
+    bool const created = createEdgesSet(&oldEdges, numberOfOldEdges);
+    for (i = 0; (i < gNumberOfFiles) && created; i++)
+    {
+        int j;
+        for (j = 0; j < dependencies[i].numberOfDependencies; j++)
+        {
+            addToEdgesSet(&oldEdges, i, dependencies[i].fileDependencies[j]);
+        }
+    }
+
+    // Process the new file on top of the same Files, starting with no dependencies.
+    for (i = 0; (i < gNumberOfFiles) && created; i++)
+    {
+        dependencies[i].numberOfDependencies = NO_DEPENDENCIES;
+    }
+    if (created)
+    {
+        processFile(pNewFile, dependencies);
+    }
+    fclose(pNewFile);
+
+    int result = created ? VALID_STATE : INVALID_STATE;
+    if (created && !(analyzeDiff(dependencies, &oldEdges)))
+    {
+        printf(NO_NEW_DEPENDENCY_MESSAGE);
+    }
+
+    // Free Memory.
+    freeEdgesSet(&oldEdges);
+    freeAllFiles(dependencies);
+    free(dependencies);
+    freeFilesTable();
+
+    return result;
+}
+
+/**
+ * @brief Analyze the difference between the old and the new dependencies. The dependencies that
+ *        appear only in the new dependencies are found with the set of the old ones, and a single
+ *        search from all of them finds which close a cycle.
+ * @param dependencies The general dependencies array which holds the new File structs.
+ * @param oldEdges A pointer to the set of the dependencies of the old input file.
+ * @return true if there is a new cyclic dependency, false otherwise.
+ */
+static bool analyzeDiff(File * const dependencies, EdgesSet const *oldEdges)
+{
+    assert(dependencies != NULL || gNumberOfFiles == NO_FILES);
+    assert(oldEdges != NULL);
+
+    int numberOfEdges = NO_DEPENDENCIES;
+    int i;
+    for (i = 0; i < gNumberOfFiles; i++)
+    {
+        numberOfEdges += dependencies[i].numberOfDependencies;
+    }
+    Edge *added = (Edge *)malloc((numberOfEdges + 1) * sizeof(Edge));
+    int *roots = (int *)malloc((numberOfEdges + 1) * sizeof(int));
+    Components components = {};
+    if ((added == NULL) || (roots == NULL) || !(reserveComponents(&components, gNumberOfFiles + 1)))
+    {
+        free(roots);
+        free(added);
+        freeComponents(&components);
+        return false;
+    }
+
+    // A dependency which already appeared in the old file can not close a new cycle on it's own,
+    // every new cycle passes through at least one new dependency.
+    int numberOfAdded = NO_DEPENDENCIES;
+    for (i = 0; i < gNumberOfFiles; i++)
+    {
+        int j;
+        for (j = 0; j < dependencies[i].numberOfDependencies; j++)
+        {
+            int const dependencyIndex = dependencies[i].fileDependencies[j];
+            if (!(containsEdge(oldEdges, i, dependencyIndex)))
+            {
+                added[numberOfAdded].from = i;
+                added[numberOfAdded].to = dependencyIndex;
+                roots[numberOfAdded++] = dependencyIndex;
+            }
+        }
+    }
+
+    // Every cycle through a new dependency is in the part of the graph reachable from it, so a
+    // new dependency closes a cycle iff both of it's Files were reached in the same Component.
+    searchComponents(dependencies, &components, roots, numberOfAdded, false);
+    bool result = false;
+    for (i = 0; i < numberOfAdded; i++)
+    {
+        int const from = added[i].from;
+        int const to = added[i].to;
+        if ((components.marks[from] == components.stamp) &&
+            (components.component[from] == components.component[to]))
+        {
+            printf(NEW_DEPENDENCY_MESSAGE, dependencies[from].fileName, dependencies[to].fileName);
+            result = true;
+        }
+    }
+
+    freeComponents(&components);
+    free(roots);
+    free(added);
+    return result;
+}
+
+/**
+ * @brief Allocates an empty Edges Set for the given number of Edges.
+ * @param set A pointer to the Edges Set.
+ * @param numberOfEdges The maximal number of Edges the set should hold.
+ * @return true iff succeed.
+ */
+static bool createEdgesSet(EdgesSet *set, int const numberOfEdges)
+{
+    assert(set != NULL);
+    assert(numberOfEdges >= NO_DEPENDENCIES);
+
+    // The size is a power of two so a slot is found by masking the hash value.
+    set -> size = 1;
+    while (set -> size < (numberOfEdges * EDGES_SET_LOAD_FACTOR))
+    {
+        set -> size <<= 1;
+    }
+
+    set -> slots = (Edge *)malloc(set -> size * sizeof(Edge));
+    if (set -> slots == NULL)
+    {
+        set -> size = NO_FILES;
+        return false;
+    }
+    memset(set -> slots, EMPTY_SLOT, set -> size * sizeof(Edge));  // All bytes set means -1.
+    return true;
+}
+
+/**
+ * @brief Free the memory of the given Edges Set.
+ * @param set A pointer to the Edges Set.
+ */
+static void freeEdgesSet(EdgesSet *set)
+{
+    assert(set != NULL);
+    free(set -> slots);
+    set -> slots = NULL;
+    set -> size = NO_FILES;
+    return;
+}
+
+/**
+ * @brief Computes the slot of the given Edge in the given Edges Set.
+ * @param set A pointer to the Edges Set.
+ * @param from The index of the declaring File.
+ * @param to The index of the File it depends on.
+ * @return The first slot to look for the Edge in.
+ */
+static int edgeSlot(EdgesSet const *set, int const from, int const to)
+{
+    unsigned int const hash = ((((unsigned int)from << HASH_SHIFT) + (unsigned int)from) ^
+                               (unsigned int)to) * EDGE_HASH_MULTIPLIER;
+    return (int)((hash ^ (hash >> EDGE_HASH_FOLD)) &
+                 (unsigned int)(set -> size - 1));
+}
+
+/**
+ * @brief Adds the given Edge to the given Edges Set, which must have room for it.
+ * @param set A pointer to the Edges Set.
+ * @param from The index of the declaring File.
+ * @param to The index of the File it depends on.
+ */
+static void addToEdgesSet(EdgesSet *set, int const from, int const to)
+{
+    assert(set != NULL);
+    assert(set -> slots != NULL);
+
+    int slot = edgeSlot(set, from, to);
+    while (set -> slots[slot].from != EMPTY_SLOT)
+    {
+        if ((set -> slots[slot].from == from) && (set -> slots[slot].to == to))
+        {
+            return;
+        }
+        slot = (slot + 1) & (set -> size - 1);
+    }
+    set -> slots[slot].from = from;
+    set -> slots[slot].to = to;
+    return;
+}
+
+/**
+ * @brief Determine if the given Edges Set contains the given Edge.
+ * @param set A pointer to the Edges Set.
+ * @param from The index of the declaring File.
+ * @param to The index of the File it depends on.
+ * @return true if the Edge is in the set, false otherwise.
+ */
+static bool containsEdge(EdgesSet const *set, int const from, int const to)
+{
+    assert(set != NULL);
+    assert(set -> slots != NULL);
+
+    int slot = edgeSlot(set, from, to);
+    while (set -> slots[slot].from != EMPTY_SLOT)
+    {
+        if ((set -> slots[slot].from == from) && (set -> slots[slot].to == to))
+        {
+            return true;
+        }
+        slot = (slot + 1) & (set -> size - 1);
+    }
+    return false;
+}
+
+
+/*-----=  Watch Mode  =-----*/
+
+
+/**
+ * @brief Rebuilds the Files Table with the given capacity for all the current Files.
+ * @param dependencies The general dependencies array which holds the File structs.
+ * @param capacity The maximal number of Files the table should index.
+ * @return true iff succeed.
+ */
+static bool resizeFilesTable(File * const dependencies, int const capacity)
+{
+    freeFilesTable();
+    if (!(createFilesTable(capacity)))
+    {
+        return false;
+    }
+
+    int i;
+    for (i = 0; i < gNumberOfFiles; i++)
+    {
+        addToFilesTable(dependencies[i].fileName, i);
+    }
+    return true;
+}
+
+/**
+ * @brief Runs the program in the Watch Mode. The function keeps the processed data of the given
+ *        input file in the memory, and each time the file is saved it applies only the changed
+ *        lines and prints the updated result.
+ * @param argc The number of given arguments.
+ * @param argv[] The arguments from the user.
+ * @return 0 if the program run ended successfully, -1 if an error occurred.
+ */
+static int runWatchMode(int argc, char *argv[])
+{
+    if (argc != WATCH_ARGUMENTS_NUMBER)
+    {
+        fprintf(stderr, INVALID_WATCH_ARGUMENTS_MESSAGE);
+        return INVALID_STATE;
+    }
+    char const *path = argv[WATCH_FILE_NAME_INDEX];
+
+    // The directory of the file is watched, since editors usually save by replacing the file.
+    char *directory = (char *)malloc(strlen(path) + STRING_TERMINATOR_COUNT);
+    if (directory == NULL)
+    {
+        return INVALID_STATE;
+    }
+    strcpy(directory, path);
+    char const *baseName = path;
+    char *separator = strrchr(directory, PATH_SEPARATOR);
+    if (separator == NULL)
+    {
+        strcpy(directory, CURRENT_DIRECTORY);
+    }
+    else
+    {
+        baseName = path + (separator - directory) + 1;
+        // Keep the separator itself for a file in the root directory.
+        *(separator == directory ? separator + 1 : separator) = STRING_TERMINATOR;
+    }
+
+    WatchState state = {NULL, NO_FILES, {NULL, NULL, START_INDEX}, NULL, NULL, NULL, {}};
+    Manifest manifest = {NULL, NULL, START_INDEX};
+    int result = VALID_STATE;
+
+    int const watchDescriptor = inotify_init();
+    if ((watchDescriptor < START_INDEX) ||
+        (inotify_add_watch(watchDescriptor, directory, WATCH_EVENTS) < START_INDEX))
+    {
+        fprintf(stderr, WATCH_ERROR_MESSAGE, path);
+        result = INVALID_STATE;
+    }
+    else if (!(readManifest(path, &manifest)))
+    {
+        fprintf(stderr, INVALID_FILE_ARGUMENTS_MESSAGE, path);
+        result = INVALID_STATE;
+    }
+    else
+    {
+        struct inotify_event events[EVENTS_BUFFER_COUNT];
+        bool changed = true;
+        while (changed)
+        {
+            if (!(applyManifest(&state, &manifest)))
+            {
+                result = INVALID_STATE;
+                break;
+            }
+            analyzeResult(state.components.numberOfCyclicFiles > NO_FILES);
+            fflush(stdout);
+
+            // Wait until the watched file is saved again.
+            changed = false;
+            while (!changed)
+            {
+                ssize_t const length = read(watchDescriptor, events, sizeof(events));
+                if (length <= 0)
+                {
+                    break;
+                }
+                char const *position = (char const *)events;
+                while (position < ((char const *)events) + length)
+                {
+                    struct inotify_event const *event = (struct inotify_event const *)position;
+                    if ((event -> len > 0) && (strcmp(event -> name, baseName) == STRING_EQUALITY))
+                    {
+                        changed = true;
+                    }
+                    position += sizeof(struct inotify_event) + event -> len;
+                }
+
+                // The file may be missing for a moment while it is replaced.
+                if (changed && !(readManifest(path, &manifest)))
+                {
+                    changed = false;
+                }
+            }
+        }
+    }
+
+    // Free Memory.
+    if (watchDescriptor >= START_INDEX)
+    {
+        close(watchDescriptor);
+    }
+    freeManifest(&manifest);
+    freeManifest(&(state.manifest));
+    freeAllFiles(state.dependencies);
+    free(state.dependencies);
+    free(state.lineFiles);
+    free(state.nextLines);
+    free(state.firstLines);
+    freeComponents(&(state.components));
+    freeFilesTable();
+    free(directory);
+
+    return result;
+}
+
+/**
+ * @brief Reads the entire content of the given input file and splits it into lines.
+ * @param path The name or the path of the input file.
+ * @param manifest A pointer to the Manifest to store the content in.
+ * @return true iff succeed.
+ */
+static bool readManifest(char const *path, Manifest *manifest)
+{
+    assert(path != NULL);
+    assert(manifest != NULL);
+
+    FILE *pFile = fopen(path, READ_MODE);
+    if (pFile == NULL)
+    {
+        return false;
+    }
+
+    // Read the entire file with a single call.
+    fseek(pFile, START_INDEX, SEEK_END);
+    long const size = ftell(pFile);
+    rewind(pFile);
+    char *content = (char *)malloc(size + STRING_TERMINATOR_COUNT);
+    if ((size < START_INDEX) || (content == NULL))
+    {
+        free(content);
+        fclose(pFile);
+        return false;
+    }
+    long const readSize = (long)fread(content, sizeof(char), size, pFile);
+    fclose(pFile);
+    content[readSize] = STRING_TERMINATOR;
+
+    // Count the lines, the last line may not end with a line separator.
+    int numberOfLines = START_INDEX;
+    long i;
+    for (i = 0; i < readSize; i++)
+    {
+        if ((content[i] == LINE_SEPARATOR) || (i == readSize - 1))
+        {
+            numberOfLines++;
+        }
+    }
+    char **lines = (char **)malloc((numberOfLines + 1) * sizeof(char *));
+    if (lines == NULL)
+    {
+        free(content);
+        return false;
+    }
+
+    // Split the content into lines in place.
+    int lineIndex = START_INDEX;
+    char *lineStart = content;
+    for (i = 0; i < readSize; i++)
+    {
+        if (content[i] == LINE_SEPARATOR)
+        {
+            content[i] = STRING_TERMINATOR;
+            lines[lineIndex++] = lineStart;
+            lineStart = content + i + 1;
+        }
+    }
+    if (lineIndex < numberOfLines)
+    {
+        lines[lineIndex++] = lineStart;
+    }
+
+    freeManifest(manifest);
+    manifest -> content = content;
+    manifest -> lines = lines;
+    manifest -> numberOfLines = numberOfLines;
+    return true;
+}
+
+/**
+ * @brief Free the memory of a given Manifest.
+ * @param manifest A pointer to the Manifest to free.
+ */
+static void freeManifest(Manifest *manifest)
+{
+    if (manifest != NULL)
+    {
+        free(manifest -> content);
+        manifest -> content = NULL;
+        free(manifest -> lines);
+        manifest -> lines = NULL;
+        manifest -> numberOfLines = START_INDEX;
+    }
+    return;
+}
+
+/**
+ * @brief Makes sure the Watch Mode state has room for the given number of additional Files.
+ * @param state A pointer to the Watch Mode state.
+ * @param additionalFiles The number of Files that may be added.
+ * @return true iff succeed.
+ */
+static bool ensureCapacity(WatchState *state, int const additionalFiles)
+{
+    assert(state != NULL);
+    assert(additionalFiles >= NO_FILES);
+
+    int const required = gNumberOfFiles + additionalFiles;
+    if ((required <= state -> capacity) && (gFilesTable != NULL))
+    {
+        return true;
+    }
+
+    int capacity = (state -> capacity > NO_FILES) ? state -> capacity : 1;
+    while (capacity < required)
+    {
+        capacity *= CAPACITY_GROWTH_FACTOR;
+    }
+
+    File *dependencies = (File *)realloc(state -> dependencies, capacity * sizeof(File));
+    if (dependencies == NULL)
+    {
+        return false;
+    }
+    state -> dependencies = dependencies;
+
+    if (!(resizeIntegers(&(state -> firstLines), capacity)) ||
+        !(reserveComponents(&(state -> components), capacity)))
+    {
+        return false;
+    }
+
+    state -> capacity = capacity;
+    return resizeFilesTable(state -> dependencies, capacity);
+}
+
+/**
+ * @brief Finds the index of the File declared in the given line.
+ * @param line The line to check, it's content is not changed.
+ * @param dependencies The general dependencies array which holds the File structs.
+ * @param create true if a File that does not exist should be created, false otherwise.
+ * @return The index of the declared File, or -1 if the line does not declare an existing File.
+ */
+static int declaredFile(char const *line, File *dependencies, bool const create)
+{
+    assert(line != NULL);
+
+    char currentLine[MAX_LINE_SIZE] = {};
+    strncpy(currentLine, line, MAX_LINE_SIZE - 1);
+    char const *fileName = strtok(currentLine, FILE_NAME_DELIMITER);
+    if (fileName == NULL)
+    {
+        return FILE_NOT_FOUND;
+    }
+
+    int fileIndex = containsFile(fileName, dependencies);
+    if ((fileIndex == FILE_NOT_FOUND) && create)
+    {
+        fileIndex = addNewFile(fileName, dependencies, NO_DEPENDENCIES);
+    }
+    return fileIndex;
+}
+
+/**
+ * @brief Applies the given new content of the watched file to the Watch Mode state. Only the
+ *        changed lines are parsed to find the Files they declare, and these Files are processed
+ *        again from their own lines only. Only the Components affected by their changed
+ *        dependencies are found again. The new content replaces the current one.
+ * @param state A pointer to the Watch Mode state.
+ * @param manifest A pointer to the new content of the watched file.
+ * @return true iff succeed.
+ */
+static bool applyManifest(WatchState *state, Manifest *manifest)
+{
+    assert(state != NULL);
+    assert(manifest != NULL);
+
+    Manifest * const previous = &(state -> manifest);
+    char currentLine[MAX_LINE_SIZE] = {};
+
+    // The changed lines are between the common prefix and the common suffix of the contents.
+    int prefix = START_INDEX;
+    while ((prefix < previous -> numberOfLines) && (prefix < manifest -> numberOfLines) &&
+           (strcmp(previous -> lines[prefix], manifest -> lines[prefix]) == STRING_EQUALITY))
+    {
+        prefix++;
+    }
+    int suffix = START_INDEX;
+    while ((suffix < previous -> numberOfLines - prefix) &&
+           (suffix < manifest -> numberOfLines - prefix) &&
+           (strcmp(previous -> lines[previous -> numberOfLines - 1 - suffix],
+                   manifest -> lines[manifest -> numberOfLines - 1 - suffix]) == STRING_EQUALITY))
+    {
+        suffix++;
+    }
+    int const previousEnd = previous -> numberOfLines - suffix;
+    int const end = manifest -> numberOfLines - suffix;
+
+    // Only the changed lines may declare new Files.
+    int countEstimate = NO_FILES;
+    int i;
+    for (i = prefix; i < end; i++)
+    {
+        strncpy(currentLine, manifest -> lines[i], MAX_LINE_SIZE - 1);
+        countEstimate += 1 + countDependencies(currentLine);
+    }
+    int const numberOfChangedLines = (previousEnd - prefix) + (end - prefix);
+    int *affected = (int *)malloc((numberOfChangedLines + 1) * sizeof(int));
+    int *lineFiles = (int *)malloc((manifest -> numberOfLines + 1) * sizeof(int));
+    int *nextLines = (int *)malloc((manifest -> numberOfLines + 1) * sizeof(int));
+    if ((affected == NULL) || (lineFiles == NULL) || (nextLines == NULL) ||
+        !(ensureCapacity(state, countEstimate)))
+    {
+        free(nextLines);
+        free(lineFiles);
+        free(affected);
+        return false;
+    }
+    File * const dependencies = state -> dependencies;
+    Components * const components = &(state -> components);
+    int const previousNumberOfFiles = gNumberOfFiles;
+
+    // The lines of the common prefix and suffix declare the same Files as before.
+    if (prefix > START_INDEX)
+    {
+        memcpy(lineFiles, state -> lineFiles, prefix * sizeof(int));
+    }
+    if (suffix > START_INDEX)
+    {
+        memcpy(lineFiles + end, state -> lineFiles + previousEnd, suffix * sizeof(int));
+    }
+
+    // Mark the Files declared in the changed lines, in both the previous and the new content.
+    // Only the new lines are parsed, the Files of the previous lines are known.
+    int const affectedStamp = ++(components -> stamp);
+    int numberOfAffected = NO_FILES;
+    for (i = prefix; i < previousEnd + (end - prefix); i++)
+    {
+        int fileIndex = FILE_NOT_FOUND;
+        if (i < previousEnd)
+        {
+            fileIndex = state -> lineFiles[i];
+        }
+        else
+        {
+            int const line = prefix + (i - previousEnd);
+            fileIndex = declaredFile(manifest -> lines[line], dependencies, true);
+            lineFiles[line] = fileIndex;
+        }
+        if ((fileIndex != FILE_NOT_FOUND) && (components -> marks[fileIndex] != affectedStamp))
+        {
+            components -> marks[fileIndex] = affectedStamp;
+            affected[numberOfAffected++] = fileIndex;
+        }
+    }
+
+    // Link the lines which declare each File, the lines of the suffix may have moved.
+    int * const firstLines = state -> firstLines;
+    for (i = 0; i < gNumberOfFiles; i++)
+    {
+        firstLines[i] = NO_LINE;
+    }
+    for (i = manifest -> numberOfLines - 1; i >= START_INDEX; i--)
+    {
+        if (lineFiles[i] != FILE_NOT_FOUND)
+        {
+            nextLines[i] = firstLines[lineFiles[i]];
+            firstLines[lineFiles[i]] = i;
+        }
+    }
+
+    // Keep the previous dependencies of the affected Files, and process them again from the
+    // lines which declare them.
+    File *previousFiles = (File *)malloc((numberOfAffected + 1) * sizeof(File));
+    int *roots = (int *)malloc((numberOfAffected * MAX_NUMBER_OF_DEPENDENCIES * 2 + 1) *
+                               sizeof(int));
+    if ((previousFiles == NULL) || (roots == NULL))
+    {
+        free(roots);
+        free(previousFiles);
+        free(nextLines);
+        free(lineFiles);
+        free(affected);
+        return false;
+    }
+    for (i = 0; i < numberOfAffected; i++)
+    {
+        previousFiles[i] = dependencies[affected[i]];
+        dependencies[affected[i]].numberOfDependencies = NO_DEPENDENCIES;
+    }
+    for (i = 0; i < numberOfAffected; i++)
+    {
+        int line;
+        for (line = firstLines[affected[i]]; line != NO_LINE; line = nextLines[line])
+        {
+            strncpy(currentLine, manifest -> lines[line], MAX_LINE_SIZE - 1);
+            processLine(currentLine, dependencies);
+        }
+    }
+
+    // Each new File is a Component of it's own until a search reaches it.
+    for (i = previousNumberOfFiles; i < gNumberOfFiles; i++)
+    {
+        components -> component[i] = (components -> numberOfComponents)++;
+    }
+
+    // A removed dependency may only split the Component it was in, and only if it's two Files are
+    // not connected in the Component anymore. The Files of such a Component are still reachable
+    // from the two Files of the dependency, without leaving the Component.
+    int numberOfRoots = NO_FILES;
+    for (i = 0; i < numberOfAffected; i++)
+    {
+        File * const currentFile = &(dependencies[affected[i]]);
+        File * const previousFile = &(previousFiles[i]);
+        int j;
+        for (j = 0; j < (previousFile -> numberOfDependencies); j++)
+        {
+            int const dependencyIndex = previousFile -> fileDependencies[j];
+            if (!(containsDependency(currentFile, dependencyIndex,
+                                     currentFile -> numberOfDependencies)) &&
+                (components -> component[affected[i]] ==
+                 components -> component[dependencyIndex]) &&
+                ((dependencyIndex == affected[i]) ||
+                 !(reachesFile(dependencies, components, affected[i], dependencyIndex))))
+            {
+                roots[numberOfRoots++] = affected[i];
+                roots[numberOfRoots++] = dependencyIndex;
+            }
+        }
+    }
+    searchComponents(dependencies, components, roots, numberOfRoots, true);
+
+    // An added dependency may only merge the Components reachable from it.
+    numberOfRoots = NO_FILES;
+    for (i = 0; i < numberOfAffected; i++)
+    {
+        File * const currentFile = &(dependencies[affected[i]]);
+        File * const previousFile = &(previousFiles[i]);
+        int j;
+        for (j = 0; j < (currentFile -> numberOfDependencies); j++)
+        {
+            int const dependencyIndex = currentFile -> fileDependencies[j];
+            if (!(containsDependency(previousFile, dependencyIndex,
+                                     previousFile -> numberOfDependencies)) &&
+                ((dependencyIndex == affected[i]) ||
+                 (components -> component[affected[i]] !=
+                  components -> component[dependencyIndex])))
+            {
+                roots[numberOfRoots++] = dependencyIndex;
+            }
+        }
+    }
+    searchComponents(dependencies, components, roots, numberOfRoots, false);
+
+    free(roots);
+    free(previousFiles);
+    free(affected);
+
+    // The new content replaces the previous one.
+    free(state -> lineFiles);
+    free(state -> nextLines);
+    state -> lineFiles = lineFiles;
+    state -> nextLines = nextLines;
+    freeManifest(previous);
+    *previous = *manifest;
+    manifest -> content = NULL;
+    manifest -> lines = NULL;
+    manifest -> numberOfLines = START_INDEX;
+    return true;
+}
+
+
+/*-----=  Out Of Core Mode  =-----*/
+
+
+/**
+ * @brief Runs the program in the Out Of Core Mode. The dependencies are spilled to the disk in
+ *        sorted runs which fit the given memory budget, and the cyclic dependency is determined
+ *        by trimming the files which can not be part of a cycle with sequential passes over the
+ *        dependencies, and analyzing the residue in the memory once it fits the budget. Once a
+ *        pass trims only a few dependencies, the residue is analyzed on the disk instead, so a
+ *        deep graph takes a bounded number of passes. The budget counts the Edges and the
+ *        buffers of the streams, while the file names and a few numbers per file are kept in the
+ *        memory regardless of it.
+ * @param argc The number of given arguments.
+ * @param argv[] The arguments from the user.
+ * @return 0 if the program run ended successfully, -1 if an error occurred.
+ */
+static int runOutOfCoreMode(int argc, char *argv[])
+{
+    char *budgetEnd = NULL;
+    long budget = (argc == OUT_OF_CORE_ARGUMENTS_NUMBER) ?
+                  strtol(argv[MEMORY_BUDGET_INDEX], &budgetEnd, DECIMAL_BASE) : NO_FILES;
+    if ((argc != OUT_OF_CORE_ARGUMENTS_NUMBER) || (*budgetEnd != STRING_TERMINATOR) ||
+        (budget <= NO_FILES))
+    {
+        fprintf(stderr, INVALID_OUT_OF_CORE_ARGUMENTS_MESSAGE);
+        return INVALID_STATE;
+    }
+    FILE *pFile = fopen(argv[OUT_OF_CORE_FILE_NAME_INDEX], READ_MODE);
+    if (pFile == NULL)
+    {
+        fprintf(stderr, INVALID_FILE_ARGUMENTS_MESSAGE, argv[OUT_OF_CORE_FILE_NAME_INDEX]);
+        return INVALID_STATE;
+    }
+
+    // The memory budget bounds the Edges held in the memory at once together with the buffers of
+    // the open streams. The file names and a few flags per file are kept in the memory as well.
+    budget = (budget < MIN_MEMORY_BUDGET) ? MIN_MEMORY_BUDGET :
+             (budget > MAX_MEMORY_BUDGET) ? MAX_MEMORY_BUDGET : budget;
+    size_t const edgesBytes = ((size_t)budget * KILOBYTE) - (OPEN_STREAMS * (size_t)BUFSIZ);
+    int const budgetEdges = (edgesBytes / sizeof(Edge) < MIN_EDGES_BUFFER_SIZE) ?
+                            MIN_EDGES_BUFFER_SIZE : (int)(edgesBytes / sizeof(Edge));
+    Edge *buffer = NULL;
+    int bufferSize = NO_FILES;
+    NamesTable names = {NULL, NO_FILES, NO_FILES, NULL, NO_FILES, NULL, NO_FILES};
+    FILE *pRuns = tmpfile();
+    long *ends = NULL;
+    int numberOfRuns = NO_FILES;
+    bool valid = (pRuns != NULL);
+
+    // Process the input file and spill the Edges in sorted runs. The buffer grows up to the
+    // budget, so a small input does not take all of it.
+    char currentLine[MAX_LINE_SIZE] = {};
+    int bufferUsed = START_INDEX;
+    while (valid && (fgets(currentLine, MAX_LINE_SIZE, pFile) != NULL))
+    {
+        char const *fileName = strtok(currentLine, FILE_NAME_DELIMITER);
+        int const from = (fileName == NULL) ? FILE_NOT_FOUND : internName(&names, fileName);
+        char const *fileDependency = strtok(NULL, FIRST_DEPENDENCY_DELIMITER);
+        while (valid && (from != FILE_NOT_FOUND) && (fileDependency != NULL))
+        {
+            // Same as in the memory, only a valid name after the ',' delimiter is a dependency.
+            if (isalpha(fileDependency[START_INDEX]) || isdigit(fileDependency[START_INDEX]))
+            {
+                if (bufferUsed == bufferSize)
+                {
+                    valid = (bufferSize < budgetEdges) ?
+                            growEdgesBuffer(&buffer, &bufferSize, budgetEdges) :
+                            spillRun(pRuns, buffer, &bufferUsed, &ends, &numberOfRuns);
+                }
+                Edge const edge = {from, internName(&names, fileDependency)};
+                valid = valid && (edge.to != FILE_NOT_FOUND);
+                if (valid)
+                {
+                    buffer[bufferUsed++] = edge;
+                }
+            }
+            fileDependency = strtok(NULL, DEPENDENCY_DELIMITER);
+        }
+        valid = valid && ((fileName == NULL) || (from != FILE_NOT_FOUND));
+    }
+    fclose(pFile);
+    if (valid && (bufferUsed > START_INDEX))
+    {
+        valid = spillRun(pRuns, buffer, &bufferUsed, &ends, &numberOfRuns);
+    }
+
+    // Merge the runs into a single sorted file of Edges without duplicates.
+    long numberOfEdges = NO_FILES;
+    FILE *pEdges = NULL;
+    if (valid)
+    {
+        pEdges = mergeRuns(pRuns, ends, numberOfRuns, buffer, bufferSize, &numberOfEdges);
+        valid = (pEdges != NULL);
+    }
+    else if (pRuns != NULL)
+    {
+        fclose(pRuns);
+    }
+    free(ends);
+    free(buffer);
+
+    // Trim the files which are not part of a cycle, until the residue fits the memory budget.
+    int const numberOfFiles = names.numberOfNames;
+    freeNamesTable(&names);
+    bool *alive = (bool *)malloc((numberOfFiles + 1) * sizeof(bool));
+    valid = valid && (alive != NULL);
+    bool result = false;
+    if (valid)
+    {
+        int i;
+        for (i = 0; i < numberOfFiles; i++)
+        {
+            alive[i] = true;
+        }
+
+        // A pass removes only the current sources and sinks, so once a pass removes only a few
+        // Edges (as on a long chain) the residue is analyzed on the disk instead.
+        int numberOfTrimmed = numberOfFiles;
+        long trimmedEdges = numberOfEdges;
+        while (valid && (numberOfEdges > budgetEdges) && (numberOfTrimmed > NO_FILES) &&
+               (trimmedEdges * TRIMMED_EDGES_FRACTION >= numberOfEdges))
+        {
+            long const previousEdges = numberOfEdges;
+            pEdges = trimEdges(pEdges, alive, numberOfFiles, &numberOfEdges, &numberOfTrimmed);
+            valid = (pEdges != NULL);
+            trimmedEdges = previousEdges - numberOfEdges;
+        }
+
+        // If no file was trimmed, every alive file has an alive dependency, so following the
+        // dependencies from any of them must lead to a cycle.
+        if (valid && (numberOfEdges <= budgetEdges))
+        {
+            result = analyzeResidue(pEdges, alive, numberOfFiles, numberOfEdges, &valid);
+        }
+        else if (valid)
+        {
+            result = (numberOfTrimmed == NO_FILES) ?
+                     true : peelResidue(pEdges, alive, numberOfFiles, &valid);
+        }
+    }
+    if (pEdges != NULL)
+    {
+        fclose(pEdges);
+    }
+    free(alive);
+
+    if (!valid)
+    {
+        fprintf(stderr, TEMPORARY_FILE_ERROR_MESSAGE);
+        return INVALID_STATE;
+    }
+    analyzeResult(result);
+    return VALID_STATE;
+}
+
+/**
+ * @brief Finds the index of a given file name in the Names Table, and adds it if needed.
+ * @param table A pointer to the Names Table.
+ * @param fileName The file name to find.
+ * @return The index of the file name, or -1 if the allocation failed.
+ */
+static int internName(NamesTable *table, char const *fileName)
+{
+    STATS_CALL(INTERN_NAME_CALL);
+    assert(table != NULL);
+    assert(fileName != NULL);
+
+    // Grow the slots when the table is half full, the size is a power of two.
+    if ((table -> numberOfNames + 1) * FILES_TABLE_LOAD_FACTOR > table -> numberOfSlots)
+    {
+        int const numberOfSlots = (table -> numberOfSlots > NO_FILES) ?
+                                  (table -> numberOfSlots * CAPACITY_GROWTH_FACTOR) :
+                                  NAMES_BLOCK_SIZE;
+        int *slots = (int *)malloc(numberOfSlots * sizeof(int));
+        char **names = (char **)realloc(table -> names, (numberOfSlots / FILES_TABLE_LOAD_FACTOR)
+                                                        * sizeof(char *));
+        if (names != NULL)
+        {
+            table -> names = names;
+        }
+        if ((slots == NULL) || (names == NULL))
+        {
+            free(slots);
+            return FILE_NOT_FOUND;
+        }
+        memset(slots, EMPTY_SLOT, numberOfSlots * sizeof(int));
+        int i;
+        for (i = 0; i < table -> numberOfNames; i++)
+        {
+            int slot = hashFileName(table -> names[i]) & (numberOfSlots - 1);
+            while (slots[slot] != EMPTY_SLOT)
+            {
+                slot = (slot + 1) & (numberOfSlots - 1);
+            }
+            slots[slot] = i;
+        }
+        free(table -> slots);
+        table -> slots = slots;
+        table -> numberOfSlots = numberOfSlots;
+        table -> capacity = numberOfSlots / FILES_TABLE_LOAD_FACTOR;
+    }
+
+    int slot = hashFileName(fileName) & (table -> numberOfSlots - 1);
+    while (table -> slots[slot] != EMPTY_SLOT)
+    {
+        if (strcmp(table -> names[table -> slots[slot]], fileName) == STRING_EQUALITY)
+        {
+            return table -> slots[slot];
+        }
+        slot = (slot + 1) & (table -> numberOfSlots - 1);
+    }
+
+    // Store the new name in the current block, or in a new block if it is full.
+    int const length = strlen(fileName) + STRING_TERMINATOR_COUNT;
+    if ((table -> block == NULL) ||
+        (table -> blockUsed + length > NAMES_BLOCK_SIZE + (int)sizeof(char *)))
+    {
+        int const blockSize = (length > NAMES_BLOCK_SIZE) ? length : NAMES_BLOCK_SIZE;
+        char *block = (char *)malloc(sizeof(char *) + blockSize);
+        if (block == NULL)
+        {
+            return FILE_NOT_FOUND;
+        }
+        memcpy(block, &(table -> block), sizeof(char *));
+        table -> block = block;
+        table -> blockUsed = sizeof(char *);
+    }
+    char *name = table -> block + table -> blockUsed;
+    memcpy(name, fileName, length);
+    table -> blockUsed += length;
+
+    table -> names[table -> numberOfNames] = name;
+    table -> slots[slot] = table -> numberOfNames;
+    return (table -> numberOfNames)++;
+}
+
+/**
+ * @brief Free the memory of a given Names Table.
+ * @param table A pointer to the Names Table to free.
+ */
+static void freeNamesTable(NamesTable *table)
+{
+    if (table != NULL)
+    {
+        while (table -> block != NULL)
+        {
+            char *previousBlock = NULL;
+            memcpy(&previousBlock, table -> block, sizeof(char *));
+            free(table -> block);
+            table -> block = previousBlock;
+        }
+        free(table -> names);
+        table -> names = NULL;
+        free(table -> slots);
+        table -> slots = NULL;
+    }
+    return;
+}
+
+/**
+ * @brief Compares two Edges by their declaring file and then by their dependency file.
+ * @param first A pointer to the first Edge.
+ * @param second A pointer to the second Edge.
+ * @return A negative number, zero or a positive number if the first Edge is smaller, equal or
+ *         greater than the second Edge.
+ */
+static int compareEdges(void const *first, void const *second)
+{
+    Edge const *firstEdge = (Edge const *)first;
+    Edge const *secondEdge = (Edge const *)second;
+    if (firstEdge -> from != secondEdge -> from)
+    {
+        return (firstEdge -> from < secondEdge -> from) ? -1 : 1;
+    }
+    if (firstEdge -> to != secondEdge -> to)
+    {
+        return (firstEdge -> to < secondEdge -> to) ? -1 : 1;
+    }
+    return STRING_EQUALITY;
+}
+
+/**
+ * @brief Sorts the given Edges, removes duplicates and appends them as a new run to the file of
+ *        the runs. The end of the new run, in Edges from the start of the file, is added to the
+ *        ends of the runs, and the given Edges are emptied.
+ * @param pRuns The file of the runs.
+ * @param edges The Edges to spill.
+ * @param numberOfEdges A pointer to the number of Edges to spill, set to 0.
+ * @param ends A pointer to the array of the ends of the runs.
+ * @param numberOfRuns A pointer to the number of runs.
+ * @return true iff succeed.
+ */
+static bool spillRun(FILE *pRuns, Edge *edges, int *numberOfEdges, long **ends,
+                     int *numberOfRuns)
+{
+    assert((pRuns != NULL) && (edges != NULL) && (numberOfEdges != NULL));
+    assert((ends != NULL) && (numberOfRuns != NULL));
+
+    qsort(edges, *numberOfEdges, sizeof(Edge), compareEdges);
+    int numberOfUnique = START_INDEX;
+    int i;
+    for (i = 0; i < *numberOfEdges; i++)
+    {
+        if ((numberOfUnique == START_INDEX) ||
+            (compareEdges(&(edges[numberOfUnique - 1]), &(edges[i])) != STRING_EQUALITY))
+        {
+            edges[numberOfUnique++] = edges[i];
+        }
+    }
+    *numberOfEdges = START_INDEX;
+
+    long *newEnds = (long *)realloc(*ends, (*numberOfRuns + 1) * sizeof(long));
+    if (newEnds == NULL)
+    {
+        return false;
+    }
+    *ends = newEnds;
+    long const start = (*numberOfRuns > NO_FILES) ? newEnds[*numberOfRuns - 1] : NO_FILES;
+    newEnds[(*numberOfRuns)++] = start + numberOfUnique;
+    return fwrite(edges, sizeof(Edge), numberOfUnique, pRuns) == (size_t)numberOfUnique;
+}
+
+/**
+ * @brief Doubles the given buffer of Edges, up to the given maximal size.
+ * @param buffer A pointer to the buffer, which may be NULL.
+ * @param size A pointer to the number of Edges in the buffer.
+ * @param maxSize The maximal number of Edges in the buffer.
+ * @return true iff succeed.
+ */
+static bool growEdgesBuffer(Edge **buffer, int *size, int const maxSize)
+{
+    assert((buffer != NULL) && (size != NULL));
+
+    int newSize = (*size > maxSize / CAPACITY_GROWTH_FACTOR) ?
+                  maxSize : (*size * CAPACITY_GROWTH_FACTOR);
+    if (newSize < MIN_EDGES_BUFFER_SIZE)
+    {
+        newSize = MIN_EDGES_BUFFER_SIZE;
+    }
+    Edge *newBuffer = (Edge *)realloc(*buffer, newSize * sizeof(Edge));
+    if (newBuffer == NULL)
+    {
+        return false;
+    }
+    *buffer = newBuffer;
+    *size = newSize;
+    return true;
+}
+
+/**
+ * @brief Restores the order of a heap of Runs, ordered by their next Edge, from the given
+ *        position downwards.
+ * @param heap The heap of Runs.
+ * @param size The number of Runs in the heap.
+ * @param position The position to start from.
+ */
+static void siftRunDown(Run *heap, int const size, int position)
+{
+    assert(heap != NULL);
+    while (true)
+    {
+        int smallest = position;
+        int const left = (2 * position) + 1;
+        int const right = left + 1;
+        if ((left < size) && (compareEdges(&(heap[left].edges[heap[left].next]),
+                                           &(heap[smallest].edges[heap[smallest].next])) <
+                              STRING_EQUALITY))
+        {
+            smallest = left;
+        }
+        if ((right < size) && (compareEdges(&(heap[right].edges[heap[right].next]),
+                                            &(heap[smallest].edges[heap[smallest].next])) <
+                               STRING_EQUALITY))
+        {
+            smallest = right;
+        }
+        if (smallest == position)
+        {
+            return;
+        }
+        Run const temporary = heap[position];
+        heap[position] = heap[smallest];
+        heap[smallest] = temporary;
+        position = smallest;
+    }
+}
+
+/**
+ * @brief Makes sure the next Edge of the given Run is in the memory, and reads the following
+ *        Edges of the Run into it's part of the memory if needed, with a single seek.
+ * @param pRuns The file of the runs.
+ * @param pRun A pointer to the Run.
+ * @param valid A pointer to a flag which is set to false if the read failed.
+ * @return true iff the Run has a next Edge.
+ */
+static bool readRun(FILE *pRuns, Run *pRun, bool *valid)
+{
+    assert((pRuns != NULL) && (pRun != NULL) && (valid != NULL));
+
+    if (pRun -> next < pRun -> size)
+    {
+        return true;
+    }
+    if (!(*valid) || (pRun -> position == pRun -> end))
+    {
+        return false;
+    }
+    long const remaining = pRun -> end - pRun -> position;
+    int const count = (remaining < pRun -> capacity) ? (int)remaining : pRun -> capacity;
+    *valid = (fseek(pRuns, pRun -> position * (long)sizeof(Edge), SEEK_SET) == 0) &&
+             (fread(pRun -> edges, sizeof(Edge), count, pRuns) == (size_t)count);
+    pRun -> position += count;
+    pRun -> size = count;
+    pRun -> next = START_INDEX;
+    return *valid;
+}
+
+/**
+ * @brief Merges the given consecutive runs into a single sorted run without duplicates, which is
+ *        appended to the given file. The memory is split evenly between the runs.
+ * @param pRuns The file of the runs.
+ * @param start The start of the first run, in Edges from the start of the file.
+ * @param ends The ends of the runs to merge.
+ * @param numberOfRuns The number of runs to merge.
+ * @param pMerged The file to append the merged run to.
+ * @param memory The memory to read the runs into.
+ * @param memorySize The number of Edges in the memory.
+ * @param numberOfEdges A pointer to store the number of Edges in the merged run.
+ * @return true iff succeed.
+ */
+static bool mergeGroup(FILE *pRuns, long const start, long const *ends, int const numberOfRuns,
+                       FILE *pMerged, Edge *memory, int const memorySize, long *numberOfEdges)
+{
+    assert((pRuns != NULL) && (ends != NULL) && (pMerged != NULL) && (memory != NULL));
+    assert(numberOfEdges != NULL);
+
+    Run *heap = (Run *)malloc(numberOfRuns * sizeof(Run));
+    bool valid = (heap != NULL);
+
+    // The heap holds the Runs which were not merged to their end, ordered by their next Edge.
+    int size = START_INDEX;
+    int i;
+    for (i = 0; valid && (i < numberOfRuns); i++)
+    {
+        Run const run = {(i > START_INDEX) ? ends[i - 1] : start, ends[i],
+                         memory + (i * (memorySize / numberOfRuns)), memorySize / numberOfRuns,
+                         START_INDEX, START_INDEX};
+        heap[size] = run;
+        if (readRun(pRuns, &(heap[size]), &valid))
+        {
+            size++;
+        }
+    }
+    for (i = (size / 2) - 1; i >= START_INDEX; i--)
+    {
+        siftRunDown(heap, size, i);
+    }
+
+    *numberOfEdges = NO_FILES;
+    Edge last = {FILE_NOT_FOUND, FILE_NOT_FOUND};
+    while (valid && (size > START_INDEX))
+    {
+        Edge const *pNext = &(heap[START_INDEX].edges[heap[START_INDEX].next++]);
+        if (compareEdges(&last, pNext) != STRING_EQUALITY)
+        {
+            last = *pNext;
+            valid = (fwrite(&last, sizeof(Edge), 1, pMerged) == 1);
+            (*numberOfEdges)++;
+        }
+        if (!readRun(pRuns, &(heap[START_INDEX]), &valid))
+        {
+            heap[START_INDEX] = heap[--size];
+        }
+        siftRunDown(heap, size, START_INDEX);
+    }
+    free(heap);
+    return valid;
+}
+
+/**
+ * @brief Merges the given sorted runs into a single sorted run without duplicates. Each pass
+ *        merges groups of as many runs as the memory holds a stream buffer for, at least two,
+ *        into a new file, so only two temporary files are open at once and each run is read
+ *        through it's own part of the memory. The given file of the runs is closed.
+ * @param pRuns The file of the runs.
+ * @param ends The ends of the runs, in Edges from the start of the file, they are overwritten.
+ * @param numberOfRuns The number of runs to merge.
+ * @param memory The memory to read the runs into.
+ * @param memorySize The number of Edges in the memory.
+ * @param numberOfEdges A pointer to store the number of Edges in the merged run.
+ * @return The file of the merged run, or NULL if an error occurred.
+ */
+static FILE * mergeRuns(FILE *pRuns, long *ends, int numberOfRuns, Edge *memory,
+                        int const memorySize, long *numberOfEdges)
+{
+    assert((pRuns != NULL) && (numberOfEdges != NULL));
+    assert(((ends != NULL) && (memory != NULL)) || (numberOfRuns == NO_FILES));
+
+    // Every run is read through a part of the memory at least as large as a stream buffer.
+    int fanIn = (int)(((size_t)memorySize * sizeof(Edge)) / BUFSIZ);
+    if (fanIn < MIN_MERGE_FAN_IN)
+    {
+        fanIn = MIN_MERGE_FAN_IN;
+    }
+    bool valid = true;
+    while (valid && (numberOfRuns > 1))
+    {
+        FILE *pMerged = tmpfile();
+        valid = (pMerged != NULL);
+        int numberOfMerged = START_INDEX;
+        long start = NO_FILES;
+        int first;
+        for (first = START_INDEX; valid && (first < numberOfRuns); first += fanIn)
+        {
+            int const groupSize = (numberOfRuns - first < fanIn) ? (numberOfRuns - first) : fanIn;
+            long mergedEdges = NO_FILES;
+            valid = mergeGroup(pRuns, start, ends + first, groupSize, pMerged, memory, memorySize,
+                               &mergedEdges);
+            start = ends[first + groupSize - 1];
+
+            // The merged runs are before the runs of the group, so they never overwrite them.
+            ends[numberOfMerged] = ((numberOfMerged > START_INDEX) ? ends[numberOfMerged - 1] :
+                                    NO_FILES) + mergedEdges;
+            numberOfMerged++;
+        }
+        fclose(pRuns);
+        pRuns = pMerged;
+        numberOfRuns = numberOfMerged;
+    }
+
+    if (!valid)
+    {
+        if (pRuns != NULL)
+        {
+            fclose(pRuns);
+        }
+        return NULL;
+    }
+    *numberOfEdges = (numberOfRuns > NO_FILES) ? ends[START_INDEX] : NO_FILES;
+    rewind(pRuns);
+    return pRuns;
+}
+
+/**
+ * @brief Performs a single trimming pass over the Edges. The files which have no dependencies
+ *        or no dependants among the alive files can not be part of a cycle, so they are marked
+ *        as not alive. The Edges between alive files are written to a new file.
+ * @param pEdges The file of the current Edges, it is closed.
+ * @param alive The alive flag of each file.
+ * @param numberOfFiles The number of files.
+ * @param numberOfEdges A pointer to the number of Edges, updated to the number of Edges left.
+ * @param numberOfTrimmed A pointer to store the number of files trimmed in this pass.
+ * @return The file of the Edges left, or NULL if an error occurred.
+ */
+static FILE * trimEdges(FILE *pEdges, bool *alive, int const numberOfFiles, long *numberOfEdges,
+                        int *numberOfTrimmed)
+{
+    assert(pEdges != NULL);
+    assert(alive != NULL);
+    assert(numberOfEdges != NULL);
+    assert(numberOfTrimmed != NULL);
+
+    bool *hasDependency = (bool *)calloc(numberOfFiles + 1, sizeof(bool));
+    bool *hasDependant = (bool *)calloc(numberOfFiles + 1, sizeof(bool));
+    FILE *pLeft = tmpfile();
+    bool valid = (hasDependency != NULL) && (hasDependant != NULL) && (pLeft != NULL);
+
+    // Copy the Edges between alive files, and find which files still have such Edges.
+    Edge edge = {FILE_NOT_FOUND, FILE_NOT_FOUND};
+    *numberOfEdges = NO_FILES;
+    while (valid && (fread(&edge, sizeof(Edge), 1, pEdges) == 1))
+    {
+        if (alive[edge.from] && alive[edge.to])
+        {
+            hasDependency[edge.from] = true;
+            hasDependant[edge.to] = true;
+            valid = (fwrite(&edge, sizeof(Edge), 1, pLeft) == 1);
+            (*numberOfEdges)++;
+        }
+    }
+    fclose(pEdges);
+
+    *numberOfTrimmed = NO_FILES;
+    int i;
+    for (i = 0; valid && (i < numberOfFiles); i++)
+    {
+        if (alive[i] && !(hasDependency[i] && hasDependant[i]))
+        {
+            alive[i] = false;
+            (*numberOfTrimmed)++;
+        }
+    }
+    free(hasDependency);
+    free(hasDependant);
+
+    if (!valid && (pLeft != NULL))
+    {
+        fclose(pLeft);
+        pLeft = NULL;
+    }
+    if (pLeft != NULL)
+    {
+        rewind(pLeft);
+    }
+    return pLeft;
+}
+
+/**
+ * @brief Analyze the Edges between the alive files in the memory. The Edges are expected to be
+ *        sorted by their declaring file.
+ * @param pEdges The file of the Edges.
+ * @param alive The alive flag of each file.
+ * @param numberOfFiles The number of files.
+ * @param numberOfEdges The number of Edges in the file.
+ * @param valid A pointer to a flag which is set to false if the allocation failed.
+ * @return true if there is a cyclic dependency, false otherwise.
+ */
+static bool analyzeResidue(FILE *pEdges, bool * const alive, int const numberOfFiles,
+                           long const numberOfEdges, bool *valid)
+{
+    assert(pEdges != NULL);
+    assert(alive != NULL);
+    assert(valid != NULL);
+
+    // Load the Edges between alive files, grouped by their declaring file.
+    int *offsets = (int *)calloc(numberOfFiles + 1, sizeof(int));
+    int *targets = (int *)malloc((numberOfEdges + 1) * sizeof(int));
+    int *positions = (int *)malloc((numberOfFiles + 1) * sizeof(int));
+    int *stack = (int *)malloc((numberOfFiles + 1) * sizeof(int));
+    char *colors = (char *)calloc(numberOfFiles + 1, sizeof(char));
+    *valid = (offsets != NULL) && (targets != NULL) && (positions != NULL) && (stack != NULL) &&
+             (colors != NULL);
+
+    int numberOfTargets = START_INDEX;
+    Edge edge = {FILE_NOT_FOUND, FILE_NOT_FOUND};
+    while (*valid && (fread(&edge, sizeof(Edge), 1, pEdges) == 1))
+    {
+        if (alive[edge.from] && alive[edge.to])
+        {
+            targets[numberOfTargets++] = edge.to;
+            offsets[edge.from + 1]++;
+        }
+    }
+    int i;
+    for (i = 0; *valid && (i < numberOfFiles); i++)
+    {
+        offsets[i + 1] += offsets[i];
+        positions[i] = offsets[i];
+    }
+
+    // Iterative DFS, reaching a File which is currently visited means we found a cycle.
+    bool result = false;
+    for (i = 0; *valid && (i < numberOfFiles) && !result; i++)
+    {
+        if (colors[i] != WHITE)
+        {
+            continue;
+        }
+        int top = START_INDEX;
+        stack[top++] = i;
+        colors[i] = GRAY;
+        while ((top > START_INDEX) && !result)
+        {
+            int const current = stack[top - 1];
+            if (positions[current] == offsets[current + 1])
+            {
+                colors[current] = BLACK;
+                top--;
+                continue;
+            }
+            int const next = targets[positions[current]++];
+            if (colors[next] == GRAY)
+            {
+                result = true;
+            }
+            else if (colors[next] == WHITE)
+            {
+                colors[next] = GRAY;
+                stack[top++] = next;
+            }
+        }
+    }
+
+    free(colors);
+    free(stack);
+    free(positions);
+    free(targets);
+    free(offsets);
+    return result;
+}
+
+
+/**
+ * @brief Analyze the Edges between the alive files which do not fit the memory, by removing
+ *        the files without alive dependants one after the other (Kahn's Algorithm). Only a few
+ *        numbers per file are kept in the memory: a sequential pass finds where the Edges of each
+ *        file start, and a removed file reads it's own Edges with a single seek. So the whole
+ *        file is read about once more, however deep the graph is. The Edges are expected to be
+ *        sorted by their declaring file.
+ * @param pEdges The file of the Edges.
+ * @param alive The alive flag of each file.
+ * @param numberOfFiles The number of files.
+ * @param valid A pointer to a flag which is set to false if the allocation or a read failed.
+ * @return true if there is a cyclic dependency, false otherwise.
+ */
+static bool peelResidue(FILE *pEdges, bool * const alive, int const numberOfFiles,
+                        bool *valid)
+{
+    assert(pEdges != NULL);
+    assert(alive != NULL);
+    assert(valid != NULL);
+
+    long *firstEdges = (long *)malloc((numberOfFiles + 1) * sizeof(long));
+    int *numberOfDependencies = (int *)calloc(numberOfFiles + 1, sizeof(int));
+    int *numberOfDependants = (int *)calloc(numberOfFiles + 1, sizeof(int));
+    int *queue = (int *)malloc((numberOfFiles + 1) * sizeof(int));
+    *valid = (firstEdges != NULL) && (numberOfDependencies != NULL) &&
+             (numberOfDependants != NULL) && (queue != NULL);
+
+    // Find the Edges of each file, and count the alive dependants of each alive file.
+    long position = NO_FILES;
+    Edge edge = {FILE_NOT_FOUND, FILE_NOT_FOUND};
+    while (*valid && (fread(&edge, sizeof(Edge), 1, pEdges) == 1))
+    {
+        if (numberOfDependencies[edge.from]++ == NO_FILES)
         {
-            free(currentDependencies);
-            free(visited);
-            return true;
+            firstEdges[edge.from] = position;
+        }
+        if (alive[edge.from] && alive[edge.to])
+        {
+            numberOfDependants[edge.to]++;
         }
+        position++;
+    }
 
-        free(currentDependencies);
+    // Remove the files without alive dependants, a file which is never removed is on a cycle or
+    // depends on one.
+    int numberOfAlive = NO_FILES;
+    int head = START_INDEX;
+    int tail = START_INDEX;
+    int i;
+    for (i = 0; *valid && (i < numberOfFiles); i++)
+    {
+        if (alive[i])
+        {
+            numberOfAlive++;
+            if (numberOfDependants[i] == NO_FILES)
+            {
+                queue[tail++] = i;
+            }
+        }
+    }
+    while (*valid && (head < tail))
+    {
+        int const current = queue[head++];
+        *valid = (numberOfDependencies[current] == NO_FILES) ||
+                 (fseek(pEdges, firstEdges[current] * (long)sizeof(Edge), SEEK_SET) == 0);
+        for (i = 0; *valid && (i < numberOfDependencies[current]); i++)
+        {
+            *valid = (fread(&edge, sizeof(Edge), 1, pEdges) == 1);
+            if (*valid && alive[edge.to] && (--numberOfDependants[edge.to] == NO_FILES))
+            {
+                queue[tail++] = edge.to;
+            }
+        }
+    }
+
+    free(queue);
+    free(numberOfDependants);
+    free(numberOfDependencies);
+    free(firstEdges);
+    return tail < numberOfAlive;
+}
+
+/*-----=  Strongly Connected Components  =-----*/
+
+
+/**
+ * @brief Process the entire input file with the given name into a new dependencies array.
+ *        It is the caller's responsibility to free the returned array and the Files Table.
+ * @param fileName The name or the path of the input file.
+ * @return The general dependencies array which holds the File structs, or NULL if the input file
+ *         is invalid or the allocation failed.
+ */
+static File * loadDependencies(char const *fileName)
+{
+    assert(fileName != NULL);
 
+    FILE *pFile = fopen(fileName, READ_MODE);
+    if (pFile == NULL)
+    {
+        fprintf(stderr, INVALID_FILE_ARGUMENTS_MESSAGE, fileName);
+        return NULL;
     }
-    free(visited);
-    return false;
+
+    int const countEstimate = estimateFilesCount(pFile);
+    assert(countEstimate >= NO_FILES);
+    File *dependencies = (File *)malloc((countEstimate + 1) * sizeof(File));
+    if ((dependencies == NULL) || !(createFilesTable(countEstimate)))
+    {
+        free(dependencies);
+        fclose(pFile);
+        return NULL;
+    }
+
+    processFile(pFile, dependencies);
+    fclose(pFile);
+    return dependencies;
 }
 
 /**
- * @brief Runs a DFS Algorithm on a given file.
- * @param currentFile The pointer for the current file to run DFS on.
+ * @brief Finds the strongly connected Components of the graph of the Files (Tarjan's Algorithm).
+ *        The Components are numbered in reverse topological order, i.e. a File may only depend
+ *        on Files in a Component with the same or a smaller number.
  * @param dependencies The general dependencies array which holds the File structs.
- * @param currentDependencies The currently visited files.
- * @param visited All the files that were absolutely visited during the entire program run,
- *        i.e. a file in this array is a file which was visited and also all of its neighbours
- *        were visited.
- * @param currentIndex The current available index in the currentDependencies array.
- * @return true if there is a cyclic dependency, false otherwise.
+ * @param component An array to store the Component number of each File.
+ * @return The number of Components, or -1 if the allocation failed.
  */
-static bool dfs(File * const currentFile, File * const dependencies, File *currentDependencies,
-                File *visited, int *currentIndex)
+static int findComponents(File * const dependencies, int *component)
 {
-    assert(currentFile != NULL);
+    assert(dependencies != NULL || gNumberOfFiles == NO_FILES);
+    assert(component != NULL);
+
+    Components components = {};
+    int numberOfComponents = INVALID_STATE;
+    if (reserveComponents(&components, gNumberOfFiles + 1))
+    {
+        // A single search from all the Files numbers the Components in the order they are done.
+        searchComponents(dependencies, &components, NULL, gNumberOfFiles, false);
+        memcpy(component, components.component, gNumberOfFiles * sizeof(int));
+        numberOfComponents = components.numberOfComponents;
+    }
+    freeComponents(&components);
+    return numberOfComponents;
+}
+
+/**
+ * @brief Resizes the given array of integers to the given number of integers.
+ * @param pArray A pointer to the array, which is kept if the allocation failed.
+ * @param capacity The number of integers.
+ * @return true iff succeed.
+ */
+static bool resizeIntegers(int **pArray, int const capacity)
+{
+    int *array = (int *)realloc(*pArray, capacity * sizeof(int));
+    if (array == NULL)
+    {
+        return false;
+    }
+    *pArray = array;
+    return true;
+}
+
+/**
+ * @brief Makes sure the given Components have room for the given number of Files. The new Files
+ *        are not on a cycle, and their Component numbers are not set.
+ * @param components A pointer to the Components.
+ * @param capacity The number of Files.
+ * @return true iff succeed.
+ */
+static bool reserveComponents(Components *components, int const capacity)
+{
+    assert(components != NULL);
+
+    int const previousCapacity = components -> capacity;
+    if (capacity <= previousCapacity)
+    {
+        return true;
+    }
+    if (!(resizeIntegers(&(components -> component), capacity)) ||
+        !(resizeIntegers(&(components -> marks), capacity)) ||
+        !(resizeIntegers(&(components -> discovery), capacity)) ||
+        !(resizeIntegers(&(components -> lowLink), capacity)) ||
+        !(resizeIntegers(&(components -> positions), capacity)) ||
+        !(resizeIntegers(&(components -> stack), capacity)) ||
+        !(resizeIntegers(&(components -> callStack), capacity)))
+    {
+        return false;
+    }
+    bool *cyclic = (bool *)realloc(components -> cyclic, capacity * sizeof(bool));
+    if (cyclic == NULL)
+    {
+        return false;
+    }
+    components -> cyclic = cyclic;
+    bool *onStack = (bool *)realloc(components -> onStack, capacity * sizeof(bool));
+    if (onStack == NULL)
+    {
+        return false;
+    }
+    components -> onStack = onStack;
+
+    int const added = capacity - previousCapacity;
+    memset(components -> marks + previousCapacity, NOT_MARKED, added * sizeof(int));
+    memset(components -> cyclic + previousCapacity, false, added * sizeof(bool));
+    memset(components -> onStack + previousCapacity, false, added * sizeof(bool));
+    components -> capacity = capacity;
+    return true;
+}
+
+/**
+ * @brief Free the memory of the given Components.
+ * @param components A pointer to the Components.
+ */
+static void freeComponents(Components *components)
+{
+    assert(components != NULL);
+    free(components -> component);
+    free(components -> cyclic);
+    free(components -> marks);
+    free(components -> discovery);
+    free(components -> lowLink);
+    free(components -> positions);
+    free(components -> stack);
+    free(components -> callStack);
+    free(components -> onStack);
+    memset(components, 0, sizeof(Components));
+    return;
+}
+
+/**
+ * @brief Finds again the strongly connected Components of the Files which are reachable from the
+ *        given roots (Tarjan's Algorithm), and whether each of them is on a cycle. Every
+ *        Component of a reachable File has only reachable Files, so the Components of the other
+ *        Files are not changed. The new Components get new numbers in reverse topological order,
+ *        i.e. a File may only depend on Files in a Component with the same or a smaller number.
+ * @param dependencies The general dependencies array which holds the File structs.
+ * @param components A pointer to the Components, with room for all the Files.
+ * @param roots The indices of the Files to start from, or NULL for the first numberOfRoots Files.
+ * @param numberOfRoots The number of roots.
+ * @param withinComponents true if the search should not leave the current Component of a root.
+ */
+static void searchComponents(File * const dependencies, Components *components,
+                             int const *roots, int const numberOfRoots,
+                             bool const withinComponents)
+{
+    STATS_CALL(SEARCH_COMPONENTS_CALL);
+    assert(components != NULL);
+    assert(components -> capacity >= gNumberOfFiles);
+
+    int * const component = components -> component;
+    int * const marks = components -> marks;
+    int * const discovery = components -> discovery;
+    int * const lowLink = components -> lowLink;
+    int * const positions = components -> positions;
+    int * const stack = components -> stack;
+    int * const callStack = components -> callStack;
+    bool * const onStack = components -> onStack;
+    int const stamp = ++(components -> stamp);
+
+    // Iterative DFS, the call stack replaces the recursion so deep graphs do not overflow it.
+    int counter = START_INDEX;
+    int top = START_INDEX;
+    int i;
+    for (i = 0; i < numberOfRoots; i++)
+    {
+        int const root = (roots == NULL) ? i : roots[i];
+        if (marks[root] == stamp)
+        {
+            continue;
+        }
+        int callTop = START_INDEX;
+        marks[root] = stamp;
+        discovery[root] = lowLink[root] = counter++;
+        positions[root] = START_INDEX;
+        stack[top++] = root;
+        onStack[root] = true;
+        callStack[callTop++] = root;
+
+        while (callTop > START_INDEX)
+        {
+            int const current = callStack[callTop - 1];
+            File * const currentFile = &(dependencies[current]);
+            if (positions[current] < currentFile -> numberOfDependencies)
+            {
+                int const next = currentFile -> fileDependencies[positions[current]++];
+                if (marks[next] != stamp)
+                {
+                    // The Component of a File is replaced only after all of it's dependencies.
+                    if (withinComponents && (component[next] != component[current]))
+                    {
+                        continue;
+                    }
+                    marks[next] = stamp;
+                    discovery[next] = lowLink[next] = counter++;
+                    positions[next] = START_INDEX;
+                    stack[top++] = next;
+                    onStack[next] = true;
+                    callStack[callTop++] = next;
+                }
+                else if (onStack[next] && (discovery[next] < lowLink[current]))
+                {
+                    lowLink[current] = discovery[next];
+                }
+                continue;
+            }
+
+            // All the dependencies of the current File were visited.
+            callTop--;
+            if ((callTop > START_INDEX) && (lowLink[current] < lowLink[callStack[callTop - 1]]))
+            {
+                lowLink[callStack[callTop - 1]] = lowLink[current];
+            }
+            if (lowLink[current] == discovery[current])
+            {
+                // The Files of the new Component are on the top of the stack.
+                int first = top - 1;
+                while (stack[first] != current)
+                {
+                    first--;
+                }
+                bool const cyclic = (top - first > 1) ||
+                                    containsDependency(currentFile, current,
+                                                       currentFile -> numberOfDependencies);
+                int const number = (components -> numberOfComponents)++;
+                while (top > first)
+                {
+                    int const member = stack[--top];
+                    onStack[member] = false;
+                    component[member] = number;
+                    if (components -> cyclic[member] != cyclic)
+                    {
+                        components -> numberOfCyclicFiles += cyclic ? 1 : -1;
+                        components -> cyclic[member] = cyclic;
+                    }
+                }
+            }
+        }
+    }
+    return;
+}
+
+/**
+ * @brief Determine if the target File is reachable from the source File without leaving their
+ *        Component.
+ * @param dependencies The general dependencies array which holds the File structs.
+ * @param components A pointer to the Components, with room for all the Files.
+ * @param sourceIndex The index of the File to start the search from.
+ * @param targetIndex The index of the File to search for, in the Component of the source File.
+ * @return true if the target File is reachable, false otherwise.
+ */
+static bool reachesFile(File * const dependencies, Components *components, int const sourceIndex,
+                        int const targetIndex)
+{
+    STATS_CALL(REACHES_FILE_CALL);
     assert(dependencies != NULL);
-    assert(visited != NULL);
-    assert(currentIndex != NULL);
+    assert(components != NULL);
 
-    File *fileDependency = NULL;
-    static int visitedIndex = START_INDEX - 1;
+    if (sourceIndex == targetIndex)
+    {
+        return true;
+    }
+
+    // Iterative DFS, each File is pushed at most once so the stack never overflows.
+    int * const marks = components -> marks;
+    int * const stack = components -> stack;
+    int const stamp = ++(components -> stamp);
+    int const component = components -> component[sourceIndex];
+    int top = START_INDEX;
+    marks[sourceIndex] = stamp;
+    stack[top++] = sourceIndex;
+    while (top > START_INDEX)
+    {
+        File * const currentFile = &(dependencies[stack[--top]]);
+        int i;
+        for (i = 0; i < (currentFile -> numberOfDependencies); i++)
+        {
+            int const dependencyIndex = currentFile -> fileDependencies[i];
+            if (dependencyIndex == targetIndex)
+            {
+                return true;
+            }
+            if ((marks[dependencyIndex] != stamp) &&
+                (components -> component[dependencyIndex] == component))
+            {
+                marks[dependencyIndex] = stamp;
+                stack[top++] = dependencyIndex;
+            }
+        }
+    }
+    return false;
+}
+
+
+/*-----=  Feedback Mode  =-----*/
+
+
+/**
+ * @brief Runs the program in the Feedback Mode. For each group of Files with cyclic dependencies
+ *        the function suggests a small set of dependencies, ranked, whose removal breaks all the
+ *        cycles in the group.
+ * @param argc The number of given arguments.
+ * @param argv[] The arguments from the user.
+ * @return 0 if the program run ended successfully, -1 if an error occurred.
+ */
+static int runFeedbackMode(int argc, char *argv[])
+{
+    if (argc != MODE_ARGUMENTS_NUMBER)
+    {
+        fprintf(stderr, INVALID_FEEDBACK_ARGUMENTS_MESSAGE);
+        return INVALID_STATE;
+    }
+    File *dependencies = loadDependencies(argv[MODE_FILE_NAME_INDEX]);
+    if (dependencies == NULL)
+    {
+        freeFilesTable();
+        return INVALID_STATE;
+    }
+
+    int *component = (int *)malloc((gNumberOfFiles + 1) * sizeof(int));
+    int *componentSize = (int *)calloc(gNumberOfFiles + 1, sizeof(int));
+    bool *cyclic = (bool *)calloc(gNumberOfFiles + 1, sizeof(bool));
+    int *position = (int *)malloc((gNumberOfFiles + 1) * sizeof(int));
+    FeedbackEdge *feedback = NULL;
+    int numberOfFeedback = START_INDEX;
+    int result = ((component != NULL) && (componentSize != NULL) && (cyclic != NULL) &&
+                  (position != NULL)) ? VALID_STATE : INVALID_STATE;
 
+    // A Component has a cycle if it has more than one File, or a File which depends on itself.
+    if ((result == VALID_STATE) && (findComponents(dependencies, component) == INVALID_STATE))
+    {
+        result = INVALID_STATE;
+    }
     int i;
-    for (i = 0 ; i < (currentFile -> numberOfDependencies); i++)
+    int j;
+    int numberOfCandidates = START_INDEX;
+    for (i = 0; (i < gNumberOfFiles) && (result == VALID_STATE); i++)
     {
-        // Assigning the next dependency of currentFile.
-        fileDependency = &(dependencies[currentFile -> fileDependencies[i]]);
-        char *fileName = fileDependency -> fileName;
+        componentSize[component[i]]++;
+    }
+    for (i = 0; (i < gNumberOfFiles) && (result == VALID_STATE); i++)
+    {
+        cyclic[i] = (componentSize[component[i]] > 1);
+        for (j = 0; j < dependencies[i].numberOfDependencies; j++)
+        {
+            int const dependencyIndex = dependencies[i].fileDependencies[j];
+            cyclic[i] = cyclic[i] || (dependencyIndex == i);
+            numberOfCandidates += (component[dependencyIndex] == component[i]);
+        }
+    }
 
-        assert(fileName != NULL);
-        // In case the dependency file has already been fully visited, i.e. we visited it and all
-        // of it's neighbours, we can ignore it and skip to the next dependency file.
-        if (dfsContains(fileName, visited, visitedIndex))
+    // The dependencies inside a Component which go backwards in the ordering are suggested.
+    if (result == VALID_STATE)
+    {
+        feedback = (FeedbackEdge *)malloc((numberOfCandidates + 1) * sizeof(FeedbackEdge));
+        if ((feedback == NULL) || !(orderFiles(dependencies, component, cyclic, position)))
         {
-            continue;
+            result = INVALID_STATE;
         }
-        // In case dependency file is in the current dependencies array, it means we found a cycle.
-        else if (dfsContains(fileName, currentDependencies, *currentIndex))
+    }
+    for (i = 0; (i < gNumberOfFiles) && (result == VALID_STATE); i++)
+    {
+        for (j = 0; cyclic[i] && (j < dependencies[i].numberOfDependencies); j++)
         {
-            return true;
+            int const dependencyIndex = dependencies[i].fileDependencies[j];
+            if ((component[dependencyIndex] == component[i]) &&
+                (position[dependencyIndex] <= position[i]))
+            {
+                FeedbackEdge const edge = {{i, dependencyIndex}, component[i],
+                                           (dependencyIndex == i) ? SELF_DEPENDENCY_SPAN :
+                                           (position[i] - position[dependencyIndex])};
+                feedback[numberOfFeedback++] = edge;
+            }
         }
-        // Otherwise, we add the current dependency file to the current dependencies array.
-        else
+    }
+
+    // Print the suggestions of each Component, the ones which go back the furthest first.
+    if (result == VALID_STATE)
+    {
+        qsort(feedback, numberOfFeedback, sizeof(FeedbackEdge), compareFeedbackEdges);
+        int rank = START_INDEX;
+        for (i = 0; i < numberOfFeedback; i++)
         {
-            assert(fileDependency != NULL);
-            currentDependencies[++(*currentIndex)] = *fileDependency;
+            if ((i == START_INDEX) || (feedback[i].component != feedback[i - 1].component))
+            {
+                printf(FEEDBACK_COMPONENT_MESSAGE, componentSize[feedback[i].component]);
+                rank = START_INDEX;
+            }
+            printf(FEEDBACK_EDGE_MESSAGE, ++rank, dependencies[feedback[i].edge.from].fileName,
+                   dependencies[feedback[i].edge.to].fileName);
+        }
+        if (numberOfFeedback == START_INDEX)
+        {
+            printf(NO_DEPENDENCY_MESSAGE);
         }
+    }
 
-        // We recursively call for DFS with the current dependency file.
-        if (dfs(fileDependency, dependencies, currentDependencies, visited, currentIndex))
+    // Free Memory.
+    free(feedback);
+    free(position);
+    free(cyclic);
+    free(componentSize);
+    free(component);
+    freeAllFiles(dependencies);
+    free(dependencies);
+    freeFilesTable();
+    return result;
+}
+
+/**
+ * @brief Moves a File to the list which matches it's remaining dependencies and dependants in
+ *        the ordering.
+ * @param file The index of the File to move.
+ * @param lists The list of each File.
+ * @param heads The first File of each list.
+ * @param next The next File in the list of each File.
+ * @param previous The previous File in the list of each File.
+ * @param outDegree The number of remaining dependencies of each File.
+ * @param inDegree The number of remaining dependants of each File.
+ * @param maxList A pointer to the highest list which may not be empty.
+ */
+static void moveFile(int const file, int *lists, int *heads, int *next, int *previous,
+                     int * const outDegree, int * const inDegree, int *maxList)
+{
+    // Remove the File from it's current list.
+    if (lists[file] != FILE_NOT_FOUND)
+    {
+        if (previous[file] != FILE_NOT_FOUND)
         {
-            return true;
+            next[previous[file]] = next[file];
+        }
+        else
+        {
+            heads[lists[file]] = next[file];
+        }
+        if (next[file] != FILE_NOT_FOUND)
+        {
+            previous[next[file]] = previous[file];
         }
     }
 
-    // After visiting all of currentFile neighbours, we add it to the visited array if needed.
-    assert((currentFile -> fileName) != NULL);
-    if (!(dfsContains(currentFile -> fileName, visited, visitedIndex)))
+    // The buckets are ordered by the difference of dependencies and dependants, with an offset
+    // so the lowest possible difference is in the first bucket.
+    int list = FIRST_BUCKET_LIST + gNumberOfFiles + outDegree[file] - inDegree[file];
+    if (outDegree[file] == NO_DEPENDENCIES)
     {
-        visited[++visitedIndex] = *currentFile;
+        list = SINKS_LIST;
+    }
+    else if (inDegree[file] == NO_DEPENDENCIES)
+    {
+        list = SOURCES_LIST;
+    }
+    else if (list > *maxList)
+    {
+        *maxList = list;
     }
 
-    return false;
+    lists[file] = list;
+    previous[file] = FILE_NOT_FOUND;
+    next[file] = heads[list];
+    if (heads[list] != FILE_NOT_FOUND)
+    {
+        previous[heads[list]] = file;
+    }
+    heads[list] = file;
+    return;
 }
 
 /**
- * @brief Determine if the given file name appears in the given dependencies array.
- *        This function used in the DFS Algorithm.
- * @param fileName The file name to check.
- * @param dependencies The array to check in.
- * @param count The current amount of files in the dependencies.
- * @return true if there is a cyclic dependency, false otherwise.
+ * @brief Orders the Files of the cyclic Components so that few dependencies go backwards
+ *        (Eades-Lin-Smyth heuristic, linear time). Only dependencies inside a Component are
+ *        considered, the dependencies that go backwards form a feedback set of the Component.
+ * @param dependencies The general dependencies array which holds the File structs.
+ * @param component The Component number of each File.
+ * @param cyclic Whether each File is in a Component with a cycle.
+ * @param position An array to store the position of each cyclic File in the ordering.
+ * @return true iff succeed.
  */
-static bool dfsContains(char const *fileName, File * const dependencies, int count)
+static bool orderFiles(File * const dependencies, int * const component, bool * const cyclic,
+                       int *position)
 {
-    assert(fileName != NULL);
-    assert(dependencies != NULL);
+    int const numberOfLists = FIRST_BUCKET_LIST + (2 * gNumberOfFiles) + 1;
+    int *outDegree = (int *)calloc(gNumberOfFiles + 1, sizeof(int));
+    int *inDegree = (int *)calloc(gNumberOfFiles + 1, sizeof(int));
+    int *dependantsOffsets = (int *)calloc(gNumberOfFiles + 2, sizeof(int));
+    int *lists = (int *)malloc((gNumberOfFiles + 1) * sizeof(int));
+    int *next = (int *)malloc((gNumberOfFiles + 1) * sizeof(int));
+    int *previous = (int *)malloc((gNumberOfFiles + 1) * sizeof(int));
+    int *heads = (int *)malloc(numberOfLists * sizeof(int));
+    bool *remaining = (bool *)malloc((gNumberOfFiles + 1) * sizeof(bool));
+    int *dependants = NULL;
+    bool valid = (outDegree != NULL) && (inDegree != NULL) && (dependantsOffsets != NULL) &&
+                 (lists != NULL) && (next != NULL) && (previous != NULL) && (heads != NULL) &&
+                 (remaining != NULL);
+
+    // Count the dependencies inside the Components, without Files that depend on themselves.
+    int i;
+    int j;
+    for (i = 0; valid && (i < gNumberOfFiles); i++)
+    {
+        for (j = 0; cyclic[i] && (j < dependencies[i].numberOfDependencies); j++)
+        {
+            int const dependencyIndex = dependencies[i].fileDependencies[j];
+            if ((dependencyIndex != i) && (component[dependencyIndex] == component[i]))
+            {
+                outDegree[i]++;
+                inDegree[dependencyIndex]++;
+                dependantsOffsets[dependencyIndex + 2]++;
+            }
+        }
+    }
+
+    // Group the dependants of each File, so they can be updated when the File is removed.
+    // After the grouping the dependants of File i are between offsets i and i + 1.
+    for (i = 0; valid && (i < gNumberOfFiles); i++)
+    {
+        dependantsOffsets[i + 2] += dependantsOffsets[i + 1];
+    }
+    if (valid)
+    {
+        dependants = (int *)malloc((dependantsOffsets[gNumberOfFiles + 1] + 1) * sizeof(int));
+        valid = (dependants != NULL);
+    }
+    for (i = 0; valid && (i < gNumberOfFiles); i++)
+    {
+        for (j = 0; cyclic[i] && (j < dependencies[i].numberOfDependencies); j++)
+        {
+            int const dependencyIndex = dependencies[i].fileDependencies[j];
+            if ((dependencyIndex != i) && (component[dependencyIndex] == component[i]))
+            {
+                dependants[dependantsOffsets[dependencyIndex + 1]++] = i;
+            }
+        }
+    }
+
+    // Put each cyclic File in the list that matches it's degrees.
+    int maxList = FIRST_BUCKET_LIST;
+    int numberOfRemaining = NO_FILES;
+    for (i = 0; valid && (i < numberOfLists); i++)
+    {
+        heads[i] = FILE_NOT_FOUND;
+    }
+    for (i = 0; valid && (i < gNumberOfFiles); i++)
+    {
+        lists[i] = FILE_NOT_FOUND;
+        remaining[i] = cyclic[i];
+        if (cyclic[i])
+        {
+            moveFile(i, lists, heads, next, previous, outDegree, inDegree, &maxList);
+            numberOfRemaining++;
+        }
+    }
 
-    while (count >= START_INDEX)
+    // Sinks are placed at the end of the ordering, sources at the start, and otherwise the File
+    // with the most dependencies relative to it's dependants is placed at the start.
+    int first = START_INDEX;
+    int last = numberOfRemaining - 1;
+    while (valid && (numberOfRemaining > NO_FILES))
     {
-        assert(dependencies[count].fileName != NULL);
-        if (strcmp(dependencies[count].fileName, fileName) == STRING_EQUALITY)
+        int current = heads[SINKS_LIST];
+        if (current != FILE_NOT_FOUND)
         {
-            return true;
+            position[current] = last--;
+        }
+        else if ((current = heads[SOURCES_LIST]) != FILE_NOT_FOUND)
+        {
+            position[current] = first++;
+        }
+        else
+        {
+            while (heads[maxList] == FILE_NOT_FOUND)
+            {
+                maxList--;
+            }
+            current = heads[maxList];
+            position[current] = first++;
+        }
+        numberOfRemaining--;
+
+        // Remove the File from the graph and update it's neighbours.
+        int const list = lists[current];
+        if (previous[current] == FILE_NOT_FOUND)
+        {
+            heads[list] = next[current];
+        }
+        else
+        {
+            next[previous[current]] = next[current];
+        }
+        if (next[current] != FILE_NOT_FOUND)
+        {
+            previous[next[current]] = previous[current];
+        }
+        lists[current] = FILE_NOT_FOUND;
+        remaining[current] = false;
+
+        for (j = 0; j < dependencies[current].numberOfDependencies; j++)
+        {
+            int const dependencyIndex = dependencies[current].fileDependencies[j];
+            if (remaining[dependencyIndex] &&
+                (component[dependencyIndex] == component[current]))
+            {
+                inDegree[dependencyIndex]--;
+                moveFile(dependencyIndex, lists, heads, next, previous, outDegree, inDegree,
+                         &maxList);
+            }
+        }
+        for (j = dependantsOffsets[current]; j < dependantsOffsets[current + 1]; j++)
+        {
+            int const dependant = dependants[j];
+            if (remaining[dependant])
+            {
+                outDegree[dependant]--;
+                moveFile(dependant, lists, heads, next, previous, outDegree, inDegree, &maxList);
+            }
         }
-        count--;
     }
-    return false;
+
+    free(dependants);
+    free(remaining);
+    free(heads);
+    free(previous);
+    free(next);
+    free(lists);
+    free(dependantsOffsets);
+    free(inDegree);
+    free(outDegree);
+    return valid;
 }
 
 /**
- * @brief With the given results from the analysis process, this function perform the required
- *        actions in each scenario (cyclic or no cyclic dependency).
- * @param result A boolean variable holding the result from the analysis process.
+ * @brief Compares two suggested dependencies by their Component and then by their rank.
+ * @param first A pointer to the first FeedbackEdge.
+ * @param second A pointer to the second FeedbackEdge.
+ * @return A negative number, zero or a positive number if the first FeedbackEdge should be
+ *         printed before, together with or after the second FeedbackEdge.
  */
-static void analyzeResult(bool const result)
+static int compareFeedbackEdges(void const *first, void const *second)
 {
-    if (result)
+    FeedbackEdge const *firstEdge = (FeedbackEdge const *)first;
+    FeedbackEdge const *secondEdge = (FeedbackEdge const *)second;
+    if (firstEdge -> component != secondEdge -> component)
     {
-        printf(DEPENDENCY_MESSAGE);
+        return (firstEdge -> component > secondEdge -> component) ? -1 : 1;
     }
-    else
+    if (firstEdge -> span != secondEdge -> span)
     {
-        printf(NO_DEPENDENCY_MESSAGE);
+        return (firstEdge -> span > secondEdge -> span) ? -1 : 1;
     }
+    return compareEdges(&(firstEdge -> edge), &(secondEdge -> edge));
 }
 
 
-/*-----=  Input Handling  =-----*/
+/*-----=  Closure Mode  =-----*/
 
 
 /**
- * @brief Handles the entire process of receiving the input from the user and process it.
- *        The function verifies a valid number of arguments, and that the given arguments are
- *        valid as well (i.e. valid input file).
- *        The function returns a pointer to the input file which was as an argument.
+ * @brief Runs the program in the Closure Mode. The function computes for each File the set of
+ *        all the Files it depends on transitively, reports the size of the closure and the time
+ *        it took, and prints the set of each queried file name.
  * @param argc The number of given arguments.
  * @param argv[] The arguments from the user.
- * @return A pointer to the input file which was as an argument if the input is valid,
- *         otherwise returns NULL pointer.
+ * @return 0 if the program run ended successfully, -1 if an error occurred.
  */
-static FILE * handleInput(int argc, char *argv[])
+static int runClosureMode(int argc, char *argv[])
 {
-    // Check valid arguments.
-    if (argc != VALID_ARGUMENTS_NUMBER)
+    if (argc < MODE_ARGUMENTS_NUMBER)
     {
-        fprintf(stderr, INVALID_ARGUMENTS_MESSAGE);
-        return NULL;
+        fprintf(stderr, INVALID_CLOSURE_ARGUMENTS_MESSAGE);
+        return INVALID_STATE;
     }
-    else
+    File *dependencies = loadDependencies(argv[MODE_FILE_NAME_INDEX]);
+    if (dependencies == NULL)
     {
-        // Receive the File to check.
-        FILE *pFile = NULL;
-        pFile = fopen(argv[FILE_NAME_INDEX], READ_MODE);
-
-        // In case of bad file.
-        if (pFile == NULL)
-        {
-            fprintf(stderr, INVALID_FILE_ARGUMENTS_MESSAGE, argv[FILE_NAME_INDEX]);
-        }
-
-        return pFile;
+        freeFilesTable();
+        return INVALID_STATE;
     }
-}
-
-
-/*-----=  File Struct Handling  =-----*/
 
+    clock_t const start = clock();
+    int *component = (int *)malloc((gNumberOfFiles + 1) * sizeof(int));
+    int *membersOffsets = (int *)calloc(gNumberOfFiles + 2, sizeof(int));
+    int *members = (int *)malloc((gNumberOfFiles + 1) * sizeof(int));
+    int numberOfComponents = INVALID_STATE;
+    if ((component != NULL) && (membersOffsets != NULL) && (members != NULL))
+    {
+        numberOfComponents = findComponents(dependencies, component);
+    }
 
-/**
- * @brief Free the memory of a given File.
- * @param file The File to free it's memory.
- */
-static void freeFile(File *file)
-{
-    if (file != NULL)
+    // Group the Files of each Component.
+    int i;
+    for (i = 0; (i < gNumberOfFiles) && (numberOfComponents != INVALID_STATE); i++)
     {
-        free(file -> fileName);
-        file -> fileName = NULL;
+        membersOffsets[component[i] + 2]++;
+    }
+    for (i = 0; (i < numberOfComponents); i++)
+    {
+        membersOffsets[i + 2] += membersOffsets[i + 1];
+    }
+    for (i = 0; (i < gNumberOfFiles) && (numberOfComponents != INVALID_STATE); i++)
+    {
+        members[membersOffsets[component[i] + 1]++] = i;
     }
-    return;
-}
 
-/**
- * @brief Free the memory of given several Files.
- * @param dependencies The pointer to the Files to free.
- */
-static void freeAllFiles(File * const dependencies)
-{
-    if (dependencies != NULL)
+    // The closure is kept per Component, the Files of a Component reach the same Files.
+    int const rowWords = (numberOfComponents + WORD_BITS - 1) / WORD_BITS;
+    uint64_t *closure = NULL;
+    if (numberOfComponents != INVALID_STATE)
     {
-        int i;
-        for (i = 0 ; i < gNumberOfFiles; i++)
+        closure = (uint64_t *)calloc((size_t)numberOfComponents * rowWords + 1, sizeof(uint64_t));
+        if (closure == NULL)
         {
-            freeFile(&dependencies[i]);
+            fprintf(stderr, CLOSURE_MEMORY_MESSAGE, numberOfComponents);
         }
     }
-    return;
-}
-
-/**
- * @brief Initialize a given File struct with the desired parameters.
- * @param file A pointer to the File struct to initialize.
- * @param fileName The name of the File.
- * @param numberOfDependencies The number of dependencies of the given File.
- * @return true iff succeed.
- */
-static bool initializeFile(File *file, char const *fileName, int const numberOfDependencies)
-{
-    assert(file != NULL);
-    assert(fileName != NULL);
-    assert(numberOfDependencies >= NO_DEPENDENCIES);
+    int result = (closure == NULL) ? INVALID_STATE : VALID_STATE;
 
-    // Initialize File Name.
-    file -> fileName = (char *)malloc(strlen(fileName) + STRING_TERMINATOR_COUNT);
-    if (file -> fileName == NULL)
+    if ((result == VALID_STATE) && !(computeClosure(dependencies, component, numberOfComponents,
+                                                    members, membersOffsets, closure, rowWords)))
     {
-        return false;
+        fprintf(stderr, CLOSURE_MEMORY_MESSAGE, numberOfComponents);
+        result = INVALID_STATE;
     }
-    memcpy(file -> fileName, fileName, strlen(fileName) + STRING_TERMINATOR_COUNT);
-
-    // Initialize File Dependency.
-    file -> numberOfDependencies = numberOfDependencies;
-    return true;
-}
 
-/**
- * @brief Counts the amount of dependencies of a file in a given line.
- * @param currentLine The current line to check.
- * @return The number of dependencies the file in the given line has.
- */
-static int countDependencies(char *currentLine)
-{
-    assert(currentLine != NULL);
-    char *fileDependency = NULL;
-    int numberOfDependencies = NO_DEPENDENCIES;
-    strtok(currentLine, FILE_NAME_DELIMITER);  // Skip the file's name token.
-
-    fileDependency = strtok(NULL, FIRST_DEPENDENCY_DELIMITER);
-    while (fileDependency != NULL)
+    if (result == VALID_STATE)
     {
-        // Only if after the ',' delimiter appears a valid name, we update the dependencies number.
-        if (isalpha(fileDependency[START_INDEX]) || isdigit(fileDependency[START_INDEX]))
+        // The size of the closure is the number of pairs of a File and a File it reaches.
+        long long size = NO_FILES;
+        int c;
+        for (c = 0; c < numberOfComponents; c++)
         {
-            numberOfDependencies++;
+            uint64_t const *row = closure + ((size_t)c * rowWords);
+            long long reachable = NO_FILES;
+            int word;
+            for (word = 0; word < rowWords; word++)
+            {
+                uint64_t bits = row[word];
+                while (bits != 0)
+                {
+                    int const d = (word * WORD_BITS) + countBits((bits & -bits) - 1);
+                    reachable += membersOffsets[d + 1] - membersOffsets[d];
+                    bits &= bits - 1;
+                }
+            }
+            size += reachable * (membersOffsets[c + 1] - membersOffsets[c]);
         }
-        fileDependency = strtok(NULL, DEPENDENCY_DELIMITER);
-    }
-
-    return numberOfDependencies;
-}
-
-/**
- * @brief Creating and adding a new File struct instance to the general dependencies array.
- * @param fileName The file name for the File struct.
- * @param dependencies The general dependencies array which stores the Files.
- * @param numberOfDependencies The number of dependencies of the new File.
- * @return The index of the new File in the dependencies array.
- */
-static int addNewFile(char const *fileName, File dependencies[], int const numberOfDependencies)
-{
-    // The last index in the dependencies array which contains a File struct.
-    static int lastFileIndex = START_INDEX;
+        double const milliseconds = ((double)(clock() - start) * MILLISECONDS_PER_SECOND) /
+                                    CLOCKS_PER_SEC;
+        printf(CLOSURE_SIZE_MESSAGE, size, gNumberOfFiles, milliseconds);
 
-    // Initialize the File struct.
-    File file = {NULL, {FILE_NOT_FOUND}, NO_DEPENDENCIES};
-    initializeFile(&file, fileName, numberOfDependencies);
+        // Answer the queries from the rows of their Components.
+        for (i = FIRST_QUERY_INDEX; i < argc; i++)
+        {
+            int const fileIndex = containsFile(argv[i], dependencies);
+            if (fileIndex == FILE_NOT_FOUND)
+            {
+                printf(UNKNOWN_FILE_MESSAGE, argv[i]);
+                continue;
+            }
+            uint64_t const *row = closure + ((size_t)component[fileIndex] * rowWords);
+            long long reachable = NO_FILES;
+            for (c = 0; c < numberOfComponents; c++)
+            {
+                if ((row[c / WORD_BITS] >> (c % WORD_BITS)) & 1)
+                {
+                    reachable += membersOffsets[c + 1] - membersOffsets[c];
+                }
+            }
+            printf(CLOSURE_QUERY_MESSAGE, argv[i], reachable);
+            for (c = 0; c < numberOfComponents; c++)
+            {
+                int member;
+                for (member = membersOffsets[c];
+                     ((row[c / WORD_BITS] >> (c % WORD_BITS)) & 1) &&
+                     (member < membersOffsets[c + 1]); member++)
+                {
+                    printf(CLOSURE_FILE_MESSAGE, dependencies[members[member]].fileName);
+                }
+            }
+        }
+    }
 
-    // Insert the new File struct to the proper place in the dependencies array.
-    assert(dependencies != NULL);
-    dependencies[lastFileIndex] = file;
-    gNumberOfFiles++;
-    return lastFileIndex++;
+    // Free Memory.
+    free(closure);
+    free(members);
+    free(membersOffsets);
+    free(component);
+    freeAllFiles(dependencies);
+    free(dependencies);
+    freeFilesTable();
+    return result;
 }
 
 /**
- * @brief Updates a given File with new number of dependencies and allocating new memory for it's
- *        dependencies.
- * @param file The File to update.
- * @param numberOfDependencies The number of dependencies to add to the current count.
+ * @brief Computes the transitive closure of the graph of the Components. Each Component has a
+ *        row of bits, bit d is set iff a File of Component d is reachable from the Component by
+ *        at least one dependency. The rows are computed in reverse topological order, so each
+ *        row is the union of the rows it depends on, which are already computed.
+ * @param dependencies The general dependencies array which holds the File structs.
+ * @param component The Component number of each File.
+ * @param numberOfComponents The number of Components.
+ * @param members The Files of each Component, grouped by Component.
+ * @param membersOffsets The Files of Component c are between offsets c and c + 1 in members.
+ * @param closure The rows of the closure, all bits are expected to be zero.
+ * @param rowWords The number of words in each row.
+ * @return true iff succeed, false if the allocation failed.
  */
-static void updateExistingFile(File *file, int const numberOfDependencies)
+static bool computeClosure(File * const dependencies, int * const component,
+                           int const numberOfComponents, int * const members,
+                           int * const membersOffsets, uint64_t *closure, int const rowWords)
 {
-    // Updating the File's data.
-    assert(file != NULL);
-    file -> numberOfDependencies += numberOfDependencies;
-}
+    assert(closure != NULL);
 
-/**
- * @brief Adds new dependency to a given File if it does not exists already. The new dependency is
- *        represented as an integer, which states the index of it in the general dependencies
- *        array.
- * @param file A pointer to the File we are about to update.
- * @param fileIndex The file index representing the new dependency file.
- * @param indexToStore The current available index by order in the File's dependencies
- *                     array to insert the new dependency.
- * @param index The first index not occupied in the file dependencies array.
- */
-static void addNewDependency(File *file, int const fileIndex, int *indexToStore)
-{
-    assert(file != NULL);
-    if (!(containsDependency(file, fileIndex, *indexToStore)))
+    // The last Component each Component was merged into, so each row is merged only once.
+    int *merged = (int *)malloc((numberOfComponents + 1) * sizeof(int));
+    if (merged == NULL)
     {
-        assert(file -> fileDependencies != NULL);
-        file -> fileDependencies[*indexToStore] = fileIndex;
-        (*indexToStore)++;
+        return false;
     }
-    else
+    int c;
+    for (c = 0; c < numberOfComponents; c++)
     {
-        // If the dependency is already exists, it was counted twice so we need to update properly.
-        assert((file -> numberOfDependencies) >= NO_DEPENDENCIES);
-        file -> numberOfDependencies--;
+        merged[c] = FILE_NOT_FOUND;
     }
-    return;
+
+    // Tarjan's Algorithm numbers the Components so that dependencies go to smaller numbers.
+    for (c = 0; c < numberOfComponents; c++)
+    {
+        uint64_t * const row = closure + ((size_t)c * rowWords);
+        int member;
+        for (member = membersOffsets[c]; member < membersOffsets[c + 1]; member++)
+        {
+            File * const currentFile = &(dependencies[members[member]]);
+            int i;
+            for (i = 0; i < currentFile -> numberOfDependencies; i++)
+            {
+                int const d = component[currentFile -> fileDependencies[i]];
+                row[d / WORD_BITS] |= ((uint64_t)1) << (d % WORD_BITS);
+                if ((d != c) && (merged[d] != c))
+                {
+                    assert(d < c);
+                    merged[d] = c;
+                    orWords(row, closure + ((size_t)d * rowWords), rowWords);
+                }
+            }
+        }
+    }
+    free(merged);
+    return true;
 }
 
 /**
- * @brief Determine if a given dependency file index has already exists as a dependency of the
- *        given file pointer.
- * @param file A pointer to the File contains dependencies.
- * @param fileIndex The file index representing the dependency file.
- * @param index The first index not occupied in the file dependencies array.
- * @return true if the dependency file exists, false otherwise.
+ * @brief Sets each word of the destination to the bitwise or of it and the matching word of the
+ *        source. The loop has no dependencies between words, so with -ftree-vectorize, which the
+ *        Makefile passes for this file, it is vectorized.
+ * @param destination The destination words.
+ * @param source The source words.
+ * @param numberOfWords The number of words.
  */
-static bool containsDependency(File * const file, int const fileIndex, int const index)
+static void orWords(uint64_t * restrict destination, uint64_t const * restrict source,
+                    int const numberOfWords)
 {
-    assert(file != NULL);
-
     int i;
-    for (i = 0; i < index; i++)
+    for (i = 0; i < numberOfWords; i++)
     {
-        if ((file -> fileDependencies)[i] == fileIndex)
-        {
-            return true;
-        }
+        destination[i] |= source[i];
     }
-    return false;
+    return;
 }
 
 /**
- * @brief Determine if a given file name has already appears in the File's dependencies array.
- *        If the file exists, the function returns it's index in the array, otherwise the function
- *        returns -1
- * @param fileName The file name to check.
- * @param dependencies The array which contains the existing Files.
- * @return The index of the given file name in the array if exists, otherwise returns -1.
+ * @brief Counts the bits which are set in a given word.
+ * @param word The word to count.
+ * @return The number of bits which are set.
  */
-static int containsFile(char const *fileName, File * const dependencies)
+static int countBits(uint64_t word)
 {
-    assert(fileName != NULL);
-    assert(dependencies != NULL);
-
-    int i;
-    for (i = 0 ; i < gNumberOfFiles; i++)
+#ifdef __GNUC__
+    return __builtin_popcountll(word);
+#else
+    int count = NO_FILES;
+    while (word != 0)
     {
-        assert(dependencies[i].fileName != NULL);
-        if (strcmp(dependencies[i].fileName, fileName) == STRING_EQUALITY)
-        {
-            return i;
-        }
+        word &= word - 1;
+        count++;
     }
-    return FILE_NOT_FOUND;
+    return count;
+#endif
 }
@@ -0,0 +1,947 @@
+/**
+ * @file ListBenchmark.c
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 17 Aug 2016
+ *
+ * @brief A benchmark of the Linked List operations at scale.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A benchmark of the Linked List operations at scale.
+ * Input:       An optional largest size, as a power of 10 between 3 and 7, and an optional kind
+ *              of Linked List: linked, unrolled, concurrent, ordered or int, the typed Linked List
+ *              of int values from MyTypedList.h, or crossover.
+ * Process:     For each size from 10^3 up to the largest size and for each kind of values, which
+ *              differ in their lengths and in how many of them are duplicates, a Linked List is
+ *              filled with insertFirst, then isInList, getSizeOf, cloneList and removeData are
+ *              measured on it, and then it is freed with freeList. The int Linked List runs with
+ *              the ids of the values instead.
+ *              crossover measures only isInList on a regular and on an ordered Linked List of
+ *              the shortest unique values, for each size which is a power of 2 up to
+ *              2^MAX_CROSSOVER_EXPONENT, and finds the smallest size from which the ordered
+ *              Linked List is faster.
+ *              The functions which scan the whole Linked List run fewer times on larger sizes.
+ *              Every allocation is counted by wrapping malloc, calloc, realloc and free with the
+ *              linker option --wrap, so the program must be linked with it (see the Makefile).
+ * Output:      The number of calls, the nanoseconds per call and the allocations per call of
+ *              each operation, or an error message. freeList is a single call which frees the
+ *              whole Linked List. The numbers can be compared against a baseline run.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include "MyLinkedList.h"
+#include "MyTypedList.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def VALID_STATE 0
+ * @brief A Flag for valid state during the program run.
+ */
+#define VALID_STATE 0
+
+/**
+ * @def INVALID_STATE 1
+ * @brief A Flag for invalid state during the program run.
+ */
+#define INVALID_STATE 1
+
+/**
+ * @def SIZE_ARGUMENT_INDEX 1
+ * @brief A Macro that sets the index of the largest size in the arguments.
+ */
+#define SIZE_ARGUMENT_INDEX 1
+
+/**
+ * @def MODE_ARGUMENT_INDEX 2
+ * @brief A Macro that sets the index of the kind of Linked List in the arguments.
+ */
+#define MODE_ARGUMENT_INDEX 2
+
+/**
+ * @def MIN_SIZE_EXPONENT 3
+ * @brief A Macro that sets the smallest size, as a power of 10.
+ */
+#define MIN_SIZE_EXPONENT 3
+
+/**
+ * @def MAX_SIZE_EXPONENT 7
+ * @brief A Macro that sets the largest size that can be given, as a power of 10.
+ */
+#define MAX_SIZE_EXPONENT 7
+
+/**
+ * @def SIZE_BASE 10
+ * @brief A Macro that sets the factor between two following sizes.
+ */
+#define SIZE_BASE 10
+
+/**
+ * @def SCAN_WORK 20000000
+ * @brief A Macro that sets the number of values all the calls of a function which scans the
+ *        whole Linked List go over, so the number of calls is SCAN_WORK divided by the size.
+ */
+#define SCAN_WORK 20000000
+
+/**
+ * @def MIN_CALLS 1
+ * @brief A Macro that sets the smallest number of calls of a function.
+ */
+#define MIN_CALLS 1
+
+/**
+ * @def MAX_CLONE_CALLS 1000
+ * @brief A Macro that sets the largest number of calls of cloneList.
+ */
+#define MAX_CLONE_CALLS 1000
+
+/**
+ * @def REMOVE_FRACTION 10
+ * @brief A Macro that sets the largest part of the Linked List removeData may remove, as one
+ *        call for each REMOVE_FRACTION values, so it runs on a Linked List of about the same size.
+ */
+#define REMOVE_FRACTION 10
+
+/**
+ * @def VALUE_BUFFER_SIZE 160
+ * @brief A Macro that sets the size of the buffer for a single value.
+ */
+#define VALUE_BUFFER_SIZE 160
+
+/**
+ * @def ID_FORMAT "%x."
+ * @brief A Macro that sets the format of the beginning of a value, which makes it unique.
+ */
+#define ID_FORMAT "%x."
+
+/**
+ * @def FIRST_PADDING_CHAR 'g'
+ * @brief A Macro that sets the first character which fills a value up to its length, which is
+ *        not a hexadecimal digit.
+ */
+#define FIRST_PADDING_CHAR 'g'
+
+/**
+ * @def PADDING_CHARS 20
+ * @brief A Macro that sets the number of characters which fill a value up to its length.
+ */
+#define PADDING_CHARS 20
+
+/**
+ * @def LENGTH_HASH_MULTIPLIER 2654435761u
+ * @brief A Macro that sets the multiplier which spreads the ids of the values over their lengths.
+ */
+#define LENGTH_HASH_MULTIPLIER 2654435761u
+
+/**
+ * @def LENGTH_HASH_SHIFT 7
+ * @brief A Macro that sets the number of low bits of the spread id which are not used.
+ */
+#define LENGTH_HASH_SHIFT 7
+
+/**
+ * @def PERCENT 100
+ * @brief A Macro that sets the number of percents in a whole.
+ */
+#define PERCENT 100
+
+/**
+ * @def RANDOM_SEED 2016
+ * @brief A Macro that sets the seed of the random numbers, so every run uses the same values.
+ */
+#define RANDOM_SEED 2016
+
+/**
+ * @def NANOSECONDS_PER_SECOND 1e9
+ * @brief A Macro that sets the number of nanoseconds in a second.
+ */
+#define NANOSECONDS_PER_SECOND 1e9
+
+/**
+ * @def LINKED_MODE_NAME "linked"
+ * @brief A Macro that sets the name of a regular Linked List in the arguments.
+ */
+#define LINKED_MODE_NAME "linked"
+
+/**
+ * @def UNROLLED_MODE_NAME "unrolled"
+ * @brief A Macro that sets the name of an unrolled Linked List in the arguments.
+ */
+#define UNROLLED_MODE_NAME "unrolled"
+
+/**
+ * @def CONCURRENT_MODE_NAME "concurrent"
+ * @brief A Macro that sets the name of a concurrent Linked List in the arguments.
+ */
+#define CONCURRENT_MODE_NAME "concurrent"
+
+/**
+ * @def ORDERED_MODE_NAME "ordered"
+ * @brief A Macro that sets the name of an ordered Linked List in the arguments.
+ */
+#define ORDERED_MODE_NAME "ordered"
+
+/**
+ * @def CROSSOVER_MODE_NAME "crossover"
+ * @brief A Macro that sets the name of the comparison of a regular and an ordered Linked List.
+ */
+#define CROSSOVER_MODE_NAME "crossover"
+
+/**
+ * @def MAX_CROSSOVER_EXPONENT 14
+ * @brief A Macro that sets the largest size of the crossover comparison, as a power of 2.
+ */
+#define MAX_CROSSOVER_EXPONENT 14
+
+/**
+ * @def MAX_CROSSOVER_CALLS 100000
+ * @brief A Macro that sets the largest number of calls of isInList in the crossover comparison.
+ */
+#define MAX_CROSSOVER_CALLS 100000
+
+/**
+ * @def INT_MODE_NAME "int"
+ * @brief A Macro that sets the name of the typed Linked List of int values in the arguments.
+ */
+#define INT_MODE_NAME "int"
+
+/**
+ * @def USAGE_MESSAGE
+ * @brief A Macro that sets the message for invalid arguments.
+ */
+#define USAGE_MESSAGE \
+    "Usage: ListBenchmark [3-7] [linked|unrolled|concurrent|ordered|int|crossover]\n"
+
+/**
+ * @def FAILURE_MESSAGE "%s of %d %s values failed.\n"
+ * @brief A Macro that sets the message for a failed operation.
+ */
+#define FAILURE_MESSAGE "%s of %d %s values failed.\n"
+
+/**
+ * @def MODE_OUTPUT "%s list\n"
+ * @brief A Macro that sets the output of the kind of the benchmarked Linked List.
+ */
+#define MODE_OUTPUT "%s list\n"
+
+/**
+ * @def HEADER_OUTPUT "    size  values          operation        calls         ns/op  allocs/op\n"
+ * @brief A Macro that sets the header of the results table.
+ */
+#define HEADER_OUTPUT "    size  values          operation        calls         ns/op  allocs/op\n"
+
+/**
+ * @def CROSSOVER_HEADER_OUTPUT "    size  linked ns/op  ordered ns/op\n"
+ * @brief A Macro that sets the header of the crossover comparison.
+ */
+#define CROSSOVER_HEADER_OUTPUT "    size  linked ns/op  ordered ns/op\n"
+
+/**
+ * @def CROSSOVER_RESULT_OUTPUT "%8d  %12.1f  %13.1f\n"
+ * @brief A Macro that sets the output of the crossover comparison of a single size.
+ */
+#define CROSSOVER_RESULT_OUTPUT "%8d  %12.1f  %13.1f\n"
+
+/**
+ * @def CROSSOVER_OUTPUT "ordered isInList is faster from size %d\n"
+ * @brief A Macro that sets the output of the smallest size the ordered Linked List is faster for.
+ */
+#define CROSSOVER_OUTPUT "ordered isInList is faster from size %d\n"
+
+/**
+ * @def NO_CROSSOVER_OUTPUT "ordered isInList is not faster up to size %d\n"
+ * @brief A Macro that sets the output when the ordered Linked List is never faster.
+ */
+#define NO_CROSSOVER_OUTPUT "ordered isInList is not faster up to size %d\n"
+
+/**
+ * @def RESULT_OUTPUT "%8d  %-14s  %-11s  %11d  %12.1f  %9.3f\n"
+ * @brief A Macro that sets the output of the results of a single operation.
+ */
+#define RESULT_OUTPUT "%8d  %-14s  %-11s  %11d  %12.1f  %9.3f\n"
+
+
+/*-----=  Structs  =-----*/
+
+
+/**
+ * A structure for a kind of values in the benchmark.
+ * It holds the name of the kind, the shortest and longest length of a value, and the percent of
+ * the values which are duplicates of other values.
+ */
+typedef struct ValueKind
+{
+    char const *name;
+    int minLength;
+    int maxLength;
+    int duplicatePercent;
+} ValueKind;
+
+/**
+ * A structure for the measure of a single operation.
+ * It holds the time and the number of allocations when the measure started.
+ */
+typedef struct Measure
+{
+    double start;
+    long allocations;
+} Measure;
+
+
+/*-----=  Allocation Counting Functions  =-----*/
+
+
+/**
+ * The number of allocations since the program started, by any of the wrapped functions.
+ */
+static long gAllocations = 0;
+
+void * __real_malloc(size_t size);
+void * __real_calloc(size_t count, size_t size);
+void * __real_realloc(void *pointer, size_t size);
+void __real_free(void *pointer);
+
+/**
+ * @brief Counts an allocation and allocates with malloc. Every call to malloc in the program is
+ *        linked to this function by the linker option --wrap=malloc.
+ * @param size The number of bytes.
+ * @return A pointer to the allocated memory, or NULL if the allocation failed.
+ */
+void * __wrap_malloc(size_t size)
+{
+    gAllocations++;
+    return __real_malloc(size);
+}
+
+/**
+ * @brief Counts an allocation and allocates with calloc.
+ * @param count The number of elements.
+ * @param size The number of bytes of each element.
+ * @return A pointer to the allocated memory, or NULL if the allocation failed.
+ */
+void * __wrap_calloc(size_t count, size_t size)
+{
+    gAllocations++;
+    return __real_calloc(count, size);
+}
+
+/**
+ * @brief Counts an allocation and reallocates with realloc.
+ * @param pointer A pointer to the memory to reallocate, or NULL.
+ * @param size The number of bytes.
+ * @return A pointer to the allocated memory, or NULL if the allocation failed.
+ */
+void * __wrap_realloc(void *pointer, size_t size)
+{
+    gAllocations++;
+    return __real_realloc(pointer, size);
+}
+
+/**
+ * @brief Frees with free. It is wrapped only so every allocator function goes through the same
+ *        wrappers.
+ * @param pointer A pointer to the memory to free, or NULL.
+ */
+void __wrap_free(void *pointer)
+{
+    __real_free(pointer);
+    return;
+}
+
+
+/*-----=  Benchmark Functions  =-----*/
+
+
+/**
+ * The kinds of values the benchmark runs with.
+ */
+static ValueKind const gValueKinds[] = {
+    {"4-16B 0%dup", 4, 16, 0},
+    {"4-64B 50%dup", 4, 64, 50},
+    {"32-128B 90%dup", 32, 128, 90}
+};
+
+/**
+ * The kind of values of the typed Linked List of int values, the ids of the values.
+ */
+static ValueKind const gIntKind = {"int 0%dup", sizeof(int), sizeof(int), 0};
+
+/**
+ * @def NUMBER_OF_VALUE_KINDS (int)(sizeof(gValueKinds) / sizeof(gValueKinds[0]))
+ * @brief A Macro that sets the number of kinds of values.
+ */
+#define NUMBER_OF_VALUE_KINDS (int)(sizeof(gValueKinds) / sizeof(gValueKinds[0]))
+
+/**
+ * @brief Gets the current time in seconds, from a monotonic wall clock.
+ * @return The current time in seconds.
+ */
+static double getTime()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + (now.tv_nsec / NANOSECONDS_PER_SECOND);
+}
+
+/**
+ * @brief Starts the measure of an operation.
+ * @param pMeasure A pointer to the Measure.
+ */
+static void startMeasure(Measure *pMeasure)
+{
+    pMeasure -> allocations = gAllocations;
+    pMeasure -> start = getTime();
+    return;
+}
+
+/**
+ * @brief Ends the measure of an operation and prints its results.
+ * @param pMeasure A pointer to the Measure.
+ * @param size The size of the Linked List.
+ * @param pKind A pointer to the kind of values.
+ * @param operation The name of the operation.
+ * @param calls The number of calls of the operation.
+ * @param overhead The number of seconds of the measure which were not spent in the operation.
+ */
+static void endMeasure(Measure const *pMeasure, int const size, ValueKind const *pKind,
+                       char const *operation, int const calls, double const overhead)
+{
+    double seconds = getTime() - pMeasure -> start - overhead;
+    if (seconds < 0)
+    {
+        seconds = 0;
+    }
+    long const allocations = gAllocations - pMeasure -> allocations;
+    printf(RESULT_OUTPUT, size, pKind -> name, operation, calls,
+           (seconds * NANOSECONDS_PER_SECOND) / calls, (double)allocations / calls);
+    fflush(stdout);
+    return;
+}
+
+/**
+ * @brief Makes the value with the given id. The value starts with the id, so values with
+ *        different ids are different, and its length depends only on the id, between the
+ *        shortest and longest lengths of the given kind of values.
+ * @param value The buffer for the value, of VALUE_BUFFER_SIZE bytes.
+ * @param id The id of the value.
+ * @param pKind A pointer to the kind of values.
+ */
+static void makeValue(char *value, unsigned int const id, ValueKind const *pKind)
+{
+    unsigned int const range = (unsigned int)(pKind -> maxLength - pKind -> minLength + 1);
+    int const length = pKind -> minLength +
+                       (int)(((id * LENGTH_HASH_MULTIPLIER) >> LENGTH_HASH_SHIFT) % range);
+    int i = sprintf(value, ID_FORMAT, id);
+    while (i < length)
+    {
+        value[i] = (char)(FIRST_PADDING_CHAR + (i % PADDING_CHARS));
+        i++;
+    }
+    value[i] = '\0';
+    return;
+}
+
+/**
+ * @brief Gets the number of different values in a Linked List of the given size.
+ * @param size The size of the Linked List.
+ * @param pKind A pointer to the kind of values.
+ * @return The number of different values.
+ */
+static int getDistinctValues(int const size, ValueKind const *pKind)
+{
+    int const distinct = (int)(((long)size * (PERCENT - pKind -> duplicatePercent)) / PERCENT);
+    return (distinct > 0) ? distinct : 1;
+}
+
+/**
+ * @brief Gets the id of the value to insert in the given position.
+ * @param position The position of the value.
+ * @param distinct The number of different values.
+ * @param pKind A pointer to the kind of values.
+ * @param pSeed A pointer to the seed of the random numbers.
+ * @return The id of the value.
+ */
+static unsigned int getInsertId(int const position, int const distinct, ValueKind const *pKind,
+                                unsigned int *pSeed)
+{
+    if (pKind -> duplicatePercent == 0)
+    {
+        return (unsigned int)position;
+    }
+    return (unsigned int)(rand_r(pSeed) % distinct);
+}
+
+/**
+ * @brief Makes the values the functions which search a value are called with. Half of them are
+ *        expected to be in the Linked List and half of them not.
+ * @param calls The number of values.
+ * @param distinct The number of different values in the Linked List.
+ * @param pKind A pointer to the kind of values.
+ * @return An array of calls values of VALUE_BUFFER_SIZE bytes each, or NULL if the allocation
+ *         failed. It is the caller's responsibility to free it.
+ */
+static char * makeQueries(int const calls, int const distinct, ValueKind const *pKind)
+{
+    char *queries = (char *)malloc((size_t)calls * VALUE_BUFFER_SIZE);
+    if (queries != NULL)
+    {
+        unsigned int seed = RANDOM_SEED;
+        int i = 0;
+        while (i < calls)
+        {
+            unsigned int const id = (unsigned int)(rand_r(&seed) % (2 * distinct));
+            makeValue(queries + ((size_t)i * VALUE_BUFFER_SIZE), id, pKind);
+            i++;
+        }
+    }
+    return queries;
+}
+
+/**
+ * @brief Gets the number of calls of a function which scans the whole Linked List.
+ * @param size The size of the Linked List.
+ * @return The number of calls.
+ */
+static int getScanCalls(int const size)
+{
+    int const calls = SCAN_WORK / size;
+    return (calls > MIN_CALLS) ? calls : MIN_CALLS;
+}
+
+/**
+ * @brief Fills the given Linked List with the given number of values and measures insertFirst.
+ *        The time it takes to make the values is measured alone and is not counted.
+ * @param l A pointer to the empty Linked List.
+ * @param size The number of values to insert.
+ * @param pKind A pointer to the kind of values.
+ * @return true iff succeed.
+ */
+static bool benchmarkInsert(MyLinkedListP l, int const size, ValueKind const *pKind)
+{
+    char value[VALUE_BUFFER_SIZE];
+    int const distinct = getDistinctValues(size, pKind);
+    unsigned int seed = RANDOM_SEED;
+    double const start = getTime();
+    int i = 0;
+    while (i < size)
+    {
+        makeValue(value, getInsertId(i, distinct, pKind, &seed), pKind);
+        i++;
+    }
+    double const overhead = getTime() - start;
+
+    Measure measure;
+    seed = RANDOM_SEED;
+    bool success = true;
+    startMeasure(&measure);
+    i = 0;
+    while (success && (i < size))
+    {
+        makeValue(value, getInsertId(i, distinct, pKind, &seed), pKind);
+        success = insertFirst(l, value);
+        i++;
+    }
+    if (success)
+    {
+        endMeasure(&measure, size, pKind, "insertFirst", size, overhead);
+    }
+    return success;
+}
+
+/**
+ * @brief Measures all the operations on a Linked List of the given size and kind of values.
+ * @param createFunction The function which creates an empty Linked List of the benchmarked kind.
+ * @param size The size of the Linked List.
+ * @param pKind A pointer to the kind of values.
+ * @return true iff succeed.
+ */
+static bool runBenchmark(MyLinkedListP (*createFunction)(), int const size,
+                         ValueKind const *pKind)
+{
+    int const calls = getScanCalls(size);
+    char *queries = makeQueries(calls, getDistinctValues(size, pKind), pKind);
+    MyLinkedListP l = createFunction();
+    char const *operation = "insertFirst";
+    bool success = (queries != NULL) && (l != NULL) && benchmarkInsert(l, size, pKind);
+    Measure measure;
+
+    if (success)
+    {
+        operation = "isInList";
+        startMeasure(&measure);
+        int i = 0;
+        while (success && (i < calls))
+        {
+            success = (isInList(l, queries + ((size_t)i * VALUE_BUFFER_SIZE)) >= 0);
+            i++;
+        }
+        endMeasure(&measure, size, pKind, operation, calls, 0);
+    }
+
+    if (success)
+    {
+        operation = "getSizeOf";
+        startMeasure(&measure);
+        int i = 0;
+        while (success && (i < size))
+        {
+            success = (getSizeOf(l) > 0);
+            i++;
+        }
+        endMeasure(&measure, size, pKind, operation, size, 0);
+    }
+
+    if (success)
+    {
+        // Each clone is freed before the next one, and the time it takes is not counted.
+        operation = "cloneList";
+        int const cloneCalls = (calls < MAX_CLONE_CALLS) ? calls : MAX_CLONE_CALLS;
+        double overhead = 0;
+        startMeasure(&measure);
+        int i = 0;
+        while (success && (i < cloneCalls))
+        {
+            MyLinkedListP clone = cloneList(l);
+            success = (clone != NULL);
+            double const freeStart = getTime();
+            freeList(clone);
+            overhead += getTime() - freeStart;
+            i++;
+        }
+        endMeasure(&measure, size, pKind, operation, cloneCalls, overhead);
+    }
+
+    if (success)
+    {
+        operation = "removeData";
+        int removeCalls = size / REMOVE_FRACTION;
+        if (removeCalls > calls)
+        {
+            removeCalls = calls;
+        }
+        startMeasure(&measure);
+        int i = 0;
+        while (success && (i < removeCalls))
+        {
+            success = (removeData(l, queries + ((size_t)i * VALUE_BUFFER_SIZE)) >= 0);
+            i++;
+        }
+        endMeasure(&measure, size, pKind, operation, removeCalls, 0);
+    }
+
+    if (success)
+    {
+        operation = "freeList";
+        startMeasure(&measure);
+        freeList(l);
+        l = NULL;
+        endMeasure(&measure, size, pKind, operation, MIN_CALLS, 0);
+    }
+    else
+    {
+        fprintf(stderr, FAILURE_MESSAGE, operation, size, pKind -> name);
+        freeList(l);
+    }
+    free(queries);
+    return success;
+}
+
+/**
+ * @brief Measures all the operations on a typed Linked List of int values of the given size,
+ *        which holds the ids 0 to size - 1, as runBenchmark does.
+ * @param size The size of the Linked List.
+ * @return true iff succeed.
+ */
+static bool runIntBenchmark(int const size)
+{
+    int const calls = getScanCalls(size);
+    MyLinkedList_intP l = createList_int();
+    char const *operation = "insertFirst";
+    bool success = (l != NULL);
+    Measure measure;
+
+    if (success)
+    {
+        startMeasure(&measure);
+        int i = 0;
+        while (success && (i < size))
+        {
+            success = insertFirst_int(l, i);
+            i++;
+        }
+        endMeasure(&measure, size, &gIntKind, operation, size, 0);
+    }
+
+    if (success)
+    {
+        operation = "isInList";
+        unsigned int seed = RANDOM_SEED;
+        startMeasure(&measure);
+        int i = 0;
+        while (success && (i < calls))
+        {
+            success = (isInList_int(l, (int)(rand_r(&seed) % (2 * (unsigned int)size))) >= 0);
+            i++;
+        }
+        endMeasure(&measure, size, &gIntKind, operation, calls, 0);
+    }
+
+    if (success)
+    {
+        operation = "getSizeOf";
+        startMeasure(&measure);
+        int i = 0;
+        while (success && (i < size))
+        {
+            success = (getSizeOf_int(l) > 0);
+            i++;
+        }
+        endMeasure(&measure, size, &gIntKind, operation, size, 0);
+    }
+
+    if (success)
+    {
+        // Each clone is freed before the next one, and the time it takes is not counted.
+        operation = "cloneList";
+        int const cloneCalls = (calls < MAX_CLONE_CALLS) ? calls : MAX_CLONE_CALLS;
+        double overhead = 0;
+        startMeasure(&measure);
+        int i = 0;
+        while (success && (i < cloneCalls))
+        {
+            MyLinkedList_intP clone = cloneList_int(l);
+            success = (clone != NULL);
+            double const freeStart = getTime();
+            freeList_int(clone);
+            overhead += getTime() - freeStart;
+            i++;
+        }
+        endMeasure(&measure, size, &gIntKind, operation, cloneCalls, overhead);
+    }
+
+    if (success)
+    {
+        operation = "removeData";
+        int removeCalls = size / REMOVE_FRACTION;
+        if (removeCalls > calls)
+        {
+            removeCalls = calls;
+        }
+        unsigned int seed = RANDOM_SEED;
+        startMeasure(&measure);
+        int i = 0;
+        while (success && (i < removeCalls))
+        {
+            success = (removeData_int(l, (int)(rand_r(&seed) % (2 * (unsigned int)size))) >= 0);
+            i++;
+        }
+        endMeasure(&measure, size, &gIntKind, operation, removeCalls, 0);
+    }
+
+    if (success)
+    {
+        operation = "freeList";
+        startMeasure(&measure);
+        freeList_int(l);
+        l = NULL;
+        endMeasure(&measure, size, &gIntKind, operation, MIN_CALLS, 0);
+    }
+    else
+    {
+        fprintf(stderr, FAILURE_MESSAGE, operation, size, gIntKind.name);
+        freeList_int(l);
+    }
+    return success;
+}
+
+/**
+ * @brief Measures isInList on a Linked List of the given size, which is filled with the shortest
+ *        unique values.
+ * @param createFunction The function which creates an empty Linked List of the measured kind.
+ * @param size The size of the Linked List.
+ * @param queries The values isInList is called with, of VALUE_BUFFER_SIZE bytes each.
+ * @param calls The number of calls.
+ * @return The nanoseconds per call, or a negative number if an operation failed.
+ */
+static double measureSearch(MyLinkedListP (*createFunction)(), int const size,
+                            char const *queries, int const calls)
+{
+    char value[VALUE_BUFFER_SIZE];
+    MyLinkedListP l = createFunction();
+    bool success = (l != NULL);
+    int i = 0;
+    while (success && (i < size))
+    {
+        makeValue(value, (unsigned int)i, &(gValueKinds[0]));
+        success = insertFirst(l, value);
+        i++;
+    }
+
+    double const start = getTime();
+    i = 0;
+    while (success && (i < calls))
+    {
+        success = (isInList(l, queries + ((size_t)i * VALUE_BUFFER_SIZE)) >= 0);
+        i++;
+    }
+    double const seconds = getTime() - start;
+    freeList(l);
+    return success ? (seconds * NANOSECONDS_PER_SECOND) / calls : -1;
+}
+
+/**
+ * @brief Compares isInList on a regular and on an ordered Linked List for each size which is a
+ *        power of 2, and prints the smallest size from which the ordered Linked List is faster
+ *        for all the larger sizes.
+ * @return true iff succeed.
+ */
+static bool runCrossover()
+{
+    printf(CROSSOVER_HEADER_OUTPUT);
+    int crossover = 0;
+    int size = 1;
+    int exponent = 0;
+    while (exponent <= MAX_CROSSOVER_EXPONENT)
+    {
+        int calls = getScanCalls(size);
+        if (calls > MAX_CROSSOVER_CALLS)
+        {
+            calls = MAX_CROSSOVER_CALLS;
+        }
+        char *queries = makeQueries(calls, size, &(gValueKinds[0]));
+        if (queries == NULL)
+        {
+            fprintf(stderr, FAILURE_MESSAGE, "isInList", size, gValueKinds[0].name);
+            return false;
+        }
+        double const linked = measureSearch(createList, size, queries, calls);
+        double const ordered = measureSearch(createOrderedList, size, queries, calls);
+        free(queries);
+        if ((linked < 0) || (ordered < 0))
+        {
+            fprintf(stderr, FAILURE_MESSAGE, "isInList", size, gValueKinds[0].name);
+            return false;
+        }
+        printf(CROSSOVER_RESULT_OUTPUT, size, linked, ordered);
+        fflush(stdout);
+        if (ordered >= linked)
+        {
+            crossover = 0;
+        }
+        else if (crossover == 0)
+        {
+            crossover = size;
+        }
+        size *= 2;
+        exponent++;
+    }
+    if (crossover > 0)
+    {
+        printf(CROSSOVER_OUTPUT, crossover);
+    }
+    else
+    {
+        printf(NO_CROSSOVER_OUTPUT, size / 2);
+    }
+    return true;
+}
+
+
+/*-----=  Main  =-----*/
+
+
+/**
+ * @brief The main function that runs the program.
+ * @param argc The number of given arguments.
+ * @param argv[] The arguments from the user.
+ * @return 0 if all the operations succeeded, 1 otherwise.
+ */
+int main(int argc, char *argv[])
+{
+    int maxExponent = MAX_SIZE_EXPONENT;
+    if (argc > SIZE_ARGUMENT_INDEX)
+    {
+        maxExponent = atoi(argv[SIZE_ARGUMENT_INDEX]);
+    }
+    char const *modeName = LINKED_MODE_NAME;
+    MyLinkedListP (*createFunction)() = createList;
+    bool typed = false;
+    bool crossover = false;
+    if (argc > MODE_ARGUMENT_INDEX)
+    {
+        modeName = argv[MODE_ARGUMENT_INDEX];
+        typed = (strcmp(modeName, INT_MODE_NAME) == 0);
+        crossover = (strcmp(modeName, CROSSOVER_MODE_NAME) == 0);
+        if (strcmp(modeName, UNROLLED_MODE_NAME) == 0)
+        {
+            createFunction = createUnrolledList;
+        }
+        else if (strcmp(modeName, CONCURRENT_MODE_NAME) == 0)
+        {
+            createFunction = createConcurrentList;
+        }
+        else if (strcmp(modeName, ORDERED_MODE_NAME) == 0)
+        {
+            createFunction = createOrderedList;
+        }
+        else if ((strcmp(modeName, LINKED_MODE_NAME) != 0) && !typed && !crossover)
+        {
+            createFunction = NULL;
+        }
+    }
+    if ((argc > MODE_ARGUMENT_INDEX + 1) || (maxExponent < MIN_SIZE_EXPONENT) ||
+        (maxExponent > MAX_SIZE_EXPONENT) || (createFunction == NULL))
+    {
+        fprintf(stderr, USAGE_MESSAGE);
+        return INVALID_STATE;
+    }
+
+    printf(MODE_OUTPUT, modeName);
+    if (strcmp(modeName, CROSSOVER_MODE_NAME) == 0)
+    {
+        return runCrossover() ? VALID_STATE : INVALID_STATE;
+    }
+    printf(HEADER_OUTPUT);
+    bool success = true;
+    int size = 1;
+    int exponent = 0;
+    while (exponent < MIN_SIZE_EXPONENT)
+    {
+        size *= SIZE_BASE;
+        exponent++;
+    }
+    while (success && (exponent <= maxExponent))
+    {
+        if (typed)
+        {
+            success = runIntBenchmark(size);
+            size *= SIZE_BASE;
+            exponent++;
+            continue;
+        }
+        int i = 0;
+        while (success && (i < NUMBER_OF_VALUE_KINDS))
+        {
+            success = runBenchmark(createFunction, size, &(gValueKinds[i]));
+            i++;
+        }
+        size *= SIZE_BASE;
+        exponent++;
+    }
+    return success ? VALID_STATE : INVALID_STATE;
+}
@@ -0,0 +1,405 @@
+/**
+ * @file ListConcurrency.c
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 17 Aug 2016
+ *
+ * @brief A stress test and scaling benchmark for a Linked List shared by many threads.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A stress test and scaling benchmark for a Linked List shared by many threads.
+ * Input:       An optional maximal number of threads.
+ * Process:     For 1, 2, 4... threads up to the maximal number, all the threads run a random mix
+ *              of insertFirst, removeData and isInList on a single Linked List, first on a
+ *              regular Linked List wrapped by a global lock and then on a concurrent Linked List.
+ *              Each thread inserts and removes only values of its own, so it knows the exact
+ *              result of every operation on them, and all the threads search values which are
+ *              shared and never removed. Any unexpected result fails the run.
+ * Output:      The throughput of each Linked List for each number of threads, or an error message.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <time.h>
+#include <pthread.h>
+#include "MyLinkedList.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def VALID_STATE 0
+ * @brief A Flag for valid state during the program run.
+ */
+#define VALID_STATE 0
+
+/**
+ * @def INVALID_STATE 1
+ * @brief A Flag for invalid state during the program run.
+ */
+#define INVALID_STATE 1
+
+/**
+ * @def THREADS_ARGUMENT_INDEX 1
+ * @brief A Macro that sets the index of the maximal number of threads in the arguments.
+ */
+#define THREADS_ARGUMENT_INDEX 1
+
+/**
+ * @def DEFAULT_MAX_THREADS 8
+ * @brief A Macro that sets the maximal number of threads if it is not given.
+ */
+#define DEFAULT_MAX_THREADS 8
+
+/**
+ * @def MAX_THREADS 64
+ * @brief A Macro that sets the largest maximal number of threads that can be given.
+ */
+#define MAX_THREADS 64
+
+/**
+ * @def OPERATIONS_PER_THREAD 20000
+ * @brief A Macro that sets the number of operations each thread runs.
+ */
+#define OPERATIONS_PER_THREAD 20000
+
+/**
+ * @def KEYS_PER_THREAD 16
+ * @brief A Macro that sets the number of values each thread inserts and removes.
+ */
+#define KEYS_PER_THREAD 16
+
+/**
+ * @def SHARED_VALUES 64
+ * @brief A Macro that sets the number of values which are shared by all the threads.
+ */
+#define SHARED_VALUES 64
+
+/**
+ * @def SHARED_COPIES 4
+ * @brief A Macro that sets the number of occurrences of each shared value in the Linked List.
+ */
+#define SHARED_COPIES 4
+
+/**
+ * @def NUMBER_OF_OPERATIONS 4
+ * @brief A Macro that sets the number of kinds of operations a thread chooses from.
+ */
+#define NUMBER_OF_OPERATIONS 4
+
+/**
+ * @def VALUE_BUFFER_SIZE 32
+ * @brief A Macro that sets the size of the buffer for the name of a value.
+ */
+#define VALUE_BUFFER_SIZE 32
+
+/**
+ * @def SHARED_VALUE_FORMAT "shared-%d"
+ * @brief A Macro that sets the format of the name of a shared value.
+ */
+#define SHARED_VALUE_FORMAT "shared-%d"
+
+/**
+ * @def THREAD_VALUE_FORMAT "thread-%d-%d"
+ * @brief A Macro that sets the format of the name of a value of a single thread.
+ */
+#define THREAD_VALUE_FORMAT "thread-%d-%d"
+
+/**
+ * @def NANOSECONDS_PER_SECOND 1e9
+ * @brief A Macro that sets the number of nanoseconds in a second.
+ */
+#define NANOSECONDS_PER_SECOND 1e9
+
+/**
+ * @def USAGE_MESSAGE "Usage: ListConcurrency [max threads]\n"
+ * @brief A Macro that sets the message for invalid arguments.
+ */
+#define USAGE_MESSAGE "Usage: ListConcurrency [max threads]\n"
+
+/**
+ * @def FAILURE_MESSAGE "%s with %d threads: unexpected result.\n"
+ * @brief A Macro that sets the message for a failed stress test.
+ */
+#define FAILURE_MESSAGE "%s with %d threads: unexpected result.\n"
+
+/**
+ * @def HEADER_OUTPUT "threads  global lock (ops/s)  concurrent (ops/s)  speedup\n"
+ * @brief A Macro that sets the header of the results table.
+ */
+#define HEADER_OUTPUT "threads  global lock (ops/s)  concurrent (ops/s)  speedup\n"
+
+/**
+ * @def RESULT_OUTPUT "%7d  %20.0f  %19.0f  %7.2f\n"
+ * @brief A Macro that sets the output of the results for a single number of threads.
+ */
+#define RESULT_OUTPUT "%7d  %20.0f  %19.0f  %7.2f\n"
+
+/**
+ * @def GLOBAL_LOCK_NAME "global lock"
+ * @brief A Macro that sets the name of the Linked List wrapped by a global lock.
+ */
+#define GLOBAL_LOCK_NAME "global lock"
+
+/**
+ * @def CONCURRENT_NAME "concurrent"
+ * @brief A Macro that sets the name of the concurrent Linked List.
+ */
+#define CONCURRENT_NAME "concurrent"
+
+
+/*-----=  Structs  =-----*/
+
+
+/**
+ * A structure for a single thread of the benchmark.
+ * It holds the shared Linked List, the global lock which wraps it or NULL, the id of the thread,
+ * the seed of its random numbers, the expected number of occurrences of each of its values and
+ * whether an unexpected result was found.
+ */
+typedef struct Worker
+{
+    MyLinkedListP list;
+    pthread_mutex_t *globalLock;
+    int id;
+    unsigned int seed;
+    int counts[KEYS_PER_THREAD];
+    bool failed;
+} Worker;
+
+
+/*-----=  Benchmark Functions  =-----*/
+
+
+/**
+ * @brief Gets the current time in seconds, from a monotonic wall clock.
+ * @return The current time in seconds.
+ */
+static double getTime()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + (now.tv_nsec / NANOSECONDS_PER_SECOND);
+}
+
+/**
+ * @brief Takes the global lock of the given Worker, if there is one.
+ * @param pWorker A pointer to the Worker.
+ */
+static void lockList(Worker *pWorker)
+{
+    if (pWorker -> globalLock != NULL)
+    {
+        pthread_mutex_lock(pWorker -> globalLock);
+    }
+    return;
+}
+
+/**
+ * @brief Releases the global lock of the given Worker, if there is one.
+ * @param pWorker A pointer to the Worker.
+ */
+static void unlockList(Worker *pWorker)
+{
+    if (pWorker -> globalLock != NULL)
+    {
+        pthread_mutex_unlock(pWorker -> globalLock);
+    }
+    return;
+}
+
+/**
+ * @brief Runs the random operations of a single thread and checks their results.
+ * @param pArgument A pointer to the Worker of the thread.
+ * @return NULL.
+ */
+static void * runWorker(void *pArgument)
+{
+    Worker *pWorker = (Worker *)pArgument;
+    char value[VALUE_BUFFER_SIZE];
+
+    int i = 0;
+    while ((i < OPERATIONS_PER_THREAD) && !(pWorker -> failed))
+    {
+        int const operation = rand_r(&(pWorker -> seed)) % NUMBER_OF_OPERATIONS;
+        int const key = rand_r(&(pWorker -> seed)) % KEYS_PER_THREAD;
+        sprintf(value, THREAD_VALUE_FORMAT, pWorker -> id, key);
+
+        lockList(pWorker);
+        switch (operation)
+        {
+            case 0:
+                pWorker -> failed = !insertFirst(pWorker -> list, value);
+                (pWorker -> counts[key])++;
+                break;
+            case 1:
+                pWorker -> failed = (removeData(pWorker -> list, value) != pWorker -> counts[key]);
+                pWorker -> counts[key] = 0;
+                break;
+            case 2:
+                pWorker -> failed = (isInList(pWorker -> list, value) != pWorker -> counts[key]);
+                break;
+            default:
+                sprintf(value, SHARED_VALUE_FORMAT, key % SHARED_VALUES);
+                pWorker -> failed = (isInList(pWorker -> list, value) != SHARED_COPIES);
+                break;
+        }
+        unlockList(pWorker);
+        i++;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Runs all the threads on the given Linked List and checks its final size.
+ * @param l A pointer to the Linked List, which holds only the shared values.
+ * @param globalLock A pointer to a global lock to wrap each operation with, or NULL.
+ * @param numberOfThreads The number of threads.
+ * @param pThroughput A pointer to store the number of operations per second.
+ * @return true iff all the results were as expected.
+ */
+static bool runThreads(MyLinkedListP l, pthread_mutex_t *globalLock, int const numberOfThreads,
+                       double *pThroughput)
+{
+    Worker workers[MAX_THREADS];
+    pthread_t threads[MAX_THREADS];
+
+    int i = 0;
+    while (i < numberOfThreads)
+    {
+        Worker *pWorker = &(workers[i]);
+        pWorker -> list = l;
+        pWorker -> globalLock = globalLock;
+        pWorker -> id = i;
+        pWorker -> seed = (unsigned int)(i + 1);
+        pWorker -> failed = false;
+        int j = 0;
+        while (j < KEYS_PER_THREAD)
+        {
+            pWorker -> counts[j] = 0;
+            j++;
+        }
+        i++;
+    }
+
+    double const start = getTime();
+    int started = 0;
+    while ((started < numberOfThreads) &&
+           (pthread_create(&(threads[started]), NULL, runWorker, &(workers[started])) == 0))
+    {
+        started++;
+    }
+    bool success = (started == numberOfThreads);
+    int expectedSize = SHARED_VALUES * SHARED_COPIES;
+    i = 0;
+    while (i < started)
+    {
+        pthread_join(threads[i], NULL);
+        success = success && !(workers[i].failed);
+        int j = 0;
+        while (j < KEYS_PER_THREAD)
+        {
+            expectedSize += workers[i].counts[j];
+            j++;
+        }
+        i++;
+    }
+    double const seconds = getTime() - start;
+
+    *pThroughput = ((double)numberOfThreads * OPERATIONS_PER_THREAD) / seconds;
+    return success && (getSize(l) == expectedSize);
+}
+
+/**
+ * @brief Runs the benchmark on a new Linked List with the shared values.
+ * @param l A pointer to the new empty Linked List, which is freed by this function.
+ * @param globalLock A pointer to a global lock to wrap each operation with, or NULL.
+ * @param numberOfThreads The number of threads.
+ * @param name The name of the Linked List for the error message.
+ * @param pThroughput A pointer to store the number of operations per second.
+ * @return true iff all the results were as expected.
+ */
+static bool runBenchmark(MyLinkedListP l, pthread_mutex_t *globalLock, int const numberOfThreads,
+                         char const *name, double *pThroughput)
+{
+    char value[VALUE_BUFFER_SIZE];
+    bool success = (l != NULL);
+
+    int i = 0;
+    while (success && (i < SHARED_VALUES * SHARED_COPIES))
+    {
+        sprintf(value, SHARED_VALUE_FORMAT, i % SHARED_VALUES);
+        success = insertFirst(l, value);
+        i++;
+    }
+    success = success && runThreads(l, globalLock, numberOfThreads, pThroughput);
+    if (!success)
+    {
+        fprintf(stderr, FAILURE_MESSAGE, name, numberOfThreads);
+    }
+    freeList(l);
+    return success;
+}
+
+
+/*-----=  Main  =-----*/
+
+
+/**
+ * @brief The main function that runs the program.
+ * @param argc The number of given arguments.
+ * @param argv[] The arguments from the user.
+ * @return 0 if all the results were as expected, 1 otherwise.
+ */
+int main(int argc, char *argv[])
+{
+    int maxThreads = DEFAULT_MAX_THREADS;
+    if (argc > THREADS_ARGUMENT_INDEX)
+    {
+        maxThreads = atoi(argv[THREADS_ARGUMENT_INDEX]);
+    }
+    if ((argc > THREADS_ARGUMENT_INDEX + 1) || (maxThreads < 1) || (maxThreads > MAX_THREADS))
+    {
+        fprintf(stderr, USAGE_MESSAGE);
+        return INVALID_STATE;
+    }
+
+    pthread_mutex_t globalLock;
+    if (pthread_mutex_init(&globalLock, NULL) != 0)
+    {
+        return INVALID_STATE;
+    }
+
+    printf(HEADER_OUTPUT);
+    bool success = true;
+    int numberOfThreads = 1;
+    while (success && (numberOfThreads <= maxThreads))
+    {
+        double globalThroughput = 0;
+        double concurrentThroughput = 0;
+        success = runBenchmark(createList(), &globalLock, numberOfThreads, GLOBAL_LOCK_NAME,
+                               &globalThroughput) &&
+                  runBenchmark(createConcurrentList(), NULL, numberOfThreads, CONCURRENT_NAME,
+                               &concurrentThroughput);
+        if (success)
+        {
+            printf(RESULT_OUTPUT, numberOfThreads, globalThroughput, concurrentThroughput,
+                   concurrentThroughput / globalThroughput);
+        }
+        numberOfThreads *= 2;
+    }
+
+    pthread_mutex_destroy(&globalLock);
+    return success ? VALID_STATE : INVALID_STATE;
+}
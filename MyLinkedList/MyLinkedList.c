@@ -24,8 +24,15 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stddef.h>
 #include <assert.h>
 #include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
 #include "MyLinkedList.h"
 
 
@@ -51,10 +58,16 @@
 #define EMPTY_LIST_MESSAGE "Empty!\n"
 
 /**
- * @def PRINT_NODE_OUTPUT "'%s'->"
- * @brief A Macro that sets the output of a single Node print.
+ * @def NODE_OUTPUT_PREFIX "'"
+ * @brief A Macro that sets the output before the value of a single Node print.
  */
-#define PRINT_NODE_OUTPUT "'%s'->"
+#define NODE_OUTPUT_PREFIX "'"
+
+/**
+ * @def NODE_OUTPUT_SUFFIX "'->"
+ * @brief A Macro that sets the output after the value of a single Node print.
+ */
+#define NODE_OUTPUT_SUFFIX "'->"
 
 /**
  * @def END_OF_PRINT_OUTPUT "|| size:%d \n"
@@ -62,6 +75,55 @@
  */
 #define END_OF_PRINT_OUTPUT "|| size:%d \n"
 
+/**
+ * @def END_OF_PRINT_BUFFER_SIZE 32
+ * @brief A Macro that sets the size of the buffer for the end of a Linked List printing process.
+ */
+#define END_OF_PRINT_BUFFER_SIZE 32
+
+/**
+ * @def NUMBER_OF_SORT_RUNS 32
+ * @brief A Macro that sets the number of sorted runs sortList keeps, the i-th run holds 2^i Nodes.
+ */
+#define NUMBER_OF_SORT_RUNS 32
+
+/**
+ * @def WRITE_BUFFER_SIZE 16384
+ * @brief A Macro that sets the number of bytes a List Writer collects before it writes them.
+ */
+#define WRITE_BUFFER_SIZE 16384
+
+/**
+ * @def LIST_FILE_MAGIC "MLS1"
+ * @brief A Macro that sets the bytes at the beginning of a saved Linked List file, which also
+ *        set the version of its format.
+ */
+#define LIST_FILE_MAGIC "MLS1"
+
+/**
+ * @def LIST_FILE_MAGIC_SIZE 4
+ * @brief A Macro that sets the number of bytes at the beginning of a saved Linked List file.
+ */
+#define LIST_FILE_MAGIC_SIZE 4
+
+/**
+ * @def LIST_FILE_ALIGNMENT 4
+ * @brief A Macro that sets the alignment of the values in a saved Linked List file.
+ */
+#define LIST_FILE_ALIGNMENT 4
+
+/**
+ * @def LIST_FILE_MODE 0644
+ * @brief A Macro that sets the permissions of a new saved Linked List file.
+ */
+#define LIST_FILE_MODE 0644
+
+/**
+ * @def NO_FILE_DESCRIPTOR -1
+ * @brief A Macro that sets the file descriptor of a List Writer which writes to a stream.
+ */
+#define NO_FILE_DESCRIPTOR -1
+
 /**
  * @def STRING_TERMINATOR_COUNT 1
  * @brief A Macro that sets the number for the string terminator addition.
@@ -80,428 +142,5191 @@
  */
 #define NO_ALLOCATE_SIZE 0
 
+/**
+ * @def SIZE_CLASS_GRANULARITY 16
+ * @brief A Macro that sets the number of bytes between two following size classes of Nodes in a
+ *        Node Pool. Every Node size is rounded up to a multiple of it.
+ */
+#define SIZE_CLASS_GRANULARITY 16
+
+/**
+ * @def NUMBER_OF_SIZE_CLASSES 16
+ * @brief A Macro that sets the number of size classes in a Node Pool. Memory blocks larger than
+ *        NUMBER_OF_SIZE_CLASSES * SIZE_CLASS_GRANULARITY bytes are allocated by themselves.
+ */
+#define NUMBER_OF_SIZE_CLASSES 16
+
+/**
+ * @def LARGE_SIZE_CLASS NUMBER_OF_SIZE_CLASSES
+ * @brief A Macro that sets the size class of the memory blocks which are allocated by themselves.
+ */
+#define LARGE_SIZE_CLASS NUMBER_OF_SIZE_CLASSES
+
+/**
+ * @def FIRST_CHUNK_SIZE 1024
+ * @brief A Macro that sets the number of bytes in the first Chunk of a Node Pool.
+ */
+#define FIRST_CHUNK_SIZE 1024
+
+/**
+ * @def MAX_CHUNK_SIZE 65536
+ * @brief A Macro that sets the maximal number of bytes in a single Chunk of a Node Pool.
+ */
+#define MAX_CHUNK_SIZE 65536
+
+/**
+ * @def CHUNK_GROWTH_FACTOR 2
+ * @brief A Macro that sets the factor by which the size of each new Chunk grows.
+ */
+#define CHUNK_GROWTH_FACTOR 2
+
+/**
+ * @def BLOCK_CAPACITY 32
+ * @brief A Macro that sets the number of values in a single Block of an unrolled Linked List.
+ */
+#define BLOCK_CAPACITY 32
+
+/**
+ * @def BLOCK_DATA_SIZE 512
+ * @brief A Macro that sets the number of bytes for the values of a single Block of an unrolled
+ *        Linked List. A Block for a longer value is made as large as the value.
+ */
+#define BLOCK_DATA_SIZE 512
+
+/**
+ * @def INITIAL_INDEX_CAPACITY 16
+ * @brief A Macro that sets the initial number of entries in the Index of a Linked List.
+ *        The number of entries is always a power of 2.
+ */
+#define INITIAL_INDEX_CAPACITY 16
+
+/**
+ * @def INDEX_LOAD_NUMERATOR 3
+ * @brief A Macro that sets the numerator of the maximal load factor of an Index.
+ */
+#define INDEX_LOAD_NUMERATOR 3
+
+/**
+ * @def INDEX_LOAD_DENOMINATOR 4
+ * @brief A Macro that sets the denominator of the maximal load factor of an Index.
+ */
+#define INDEX_LOAD_DENOMINATOR 4
+
+/**
+ * @def INDEX_GROWTH_FACTOR 2
+ * @brief A Macro that sets the factor by which the number of entries in an Index grows.
+ */
+#define INDEX_GROWTH_FACTOR 2
+
+/**
+ * @def INITIAL_INTERN_CAPACITY 64
+ * @brief A Macro that sets the initial number of slots in the table of an Intern Pool.
+ */
+#define INITIAL_INTERN_CAPACITY 64
+
+/**
+ * @def INTERNED_NODE_SIZE (sizeof(Node) + sizeof(char const *))
+ * @brief A Macro that sets the number of bytes in a Node which points to an interned string.
+ */
+#define INTERNED_NODE_SIZE (sizeof(Node) + sizeof(char const *))
+
+/**
+ * @def SKIP_MAX_HEIGHT 16
+ * @brief A Macro that sets the largest number of levels of a Node in an ordered Linked List.
+ */
+#define SKIP_MAX_HEIGHT 16
+
+/**
+ * @def SKIP_LEVEL_BITS 2
+ * @brief A Macro that sets the number of random bits which decide if a Node in an ordered Linked
+ *        List has another level, so a Node is in the next level with a chance of 1 in 4.
+ */
+#define SKIP_LEVEL_BITS 2
+
+/**
+ * @def SKIP_LEVEL_MASK 3
+ * @brief A Macro that sets the mask of the random bits which decide if a Node has another level.
+ */
+#define SKIP_LEVEL_MASK 3
+
+/**
+ * @def SKIP_RANDOM_SEED 2016
+ * @brief A Macro that sets the seed of the random levels of an ordered Linked List, so the same
+ *        operations always build the same levels.
+ */
+#define SKIP_RANDOM_SEED 2016
+
+/**
+ * @def SKIP_RANDOM_MULTIPLIER 6364136223846793005ULL
+ * @brief A Macro that sets the multiplier of the random numbers of an ordered Linked List.
+ */
+#define SKIP_RANDOM_MULTIPLIER 6364136223846793005ULL
+
+/**
+ * @def SKIP_RANDOM_INCREMENT 1442695040888963407ULL
+ * @brief A Macro that sets the increment of the random numbers of an ordered Linked List.
+ */
+#define SKIP_RANDOM_INCREMENT 1442695040888963407ULL
+
+/**
+ * @def SKIP_RANDOM_SHIFT 32
+ * @brief A Macro that sets the number of low bits of a random number which are not used.
+ */
+#define SKIP_RANDOM_SHIFT 32
+
+/**
+ * @def READ_PHASES 2
+ * @brief A Macro that sets the number of phases the scans of a concurrent Linked List are
+ *        counted in, so a removal can wait for the scans which began before it.
+ */
+#define READ_PHASES 2
+
+/**
+ * @def MAX_CACHED_NODES 1024
+ * @brief A Macro that sets the maximal number of freed Nodes of concurrent Linked Lists which each
+ *        thread keeps to reuse.
+ */
+#define MAX_CACHED_NODES 1024
+
+/**
+ * @def VALUE_NOT_FOUND -1
+ * @brief A Macro that sets the result of a search for a value which is not in a Value Set.
+ */
+#define VALUE_NOT_FOUND -1
+
+/**
+ * @def HASH_INITIAL_VALUE 5381
+ * @brief A Macro that sets the initial value of the string hash function (djb2).
+ */
+#define HASH_INITIAL_VALUE 5381
+
+/**
+ * @def HASH_SHIFT 5
+ * @brief A Macro that sets the shift of the string hash function (djb2).
+ */
+#define HASH_SHIFT 5
+
+#ifdef STATS
+/**
+ * @def STATS_ADD(counter, count)
+ * @brief A Macro that adds to a counter of the List Stats, which is safe to use from many threads,
+ *        and returns its new value. Without STATS it is compiled out.
+ */
+#define STATS_ADD(counter, count) __atomic_add_fetch(&(gListStats.counter), (count), \
+                                                     __ATOMIC_RELAXED)
+
+/**
+ * @def STATS_MAX(counter, value) updateMaximum(&(gListStats.counter), (value))
+ * @brief A Macro that raises a peak counter of the List Stats to the given value if it is larger.
+ *        Without STATS it is compiled out.
+ */
+#define STATS_MAX(counter, value) updateMaximum(&(gListStats.counter), (value))
+#else
+#define STATS_ADD(counter, count) ((void)0)
+#define STATS_MAX(counter, value) ((void)0)
+#endif
+
+/**
+ * @def STATS_CALL(function) STATS_ADD(calls[function], 1)
+ * @brief A Macro that counts a call of a public function in the List Stats.
+ */
+#define STATS_CALL(function) STATS_ADD(calls[function], 1)
+
+/**
+ * @def STATS_LINE_SIZE 64
+ * @brief A Macro that sets the size of the buffer for a single line of the List Stats output.
+ */
+#define STATS_LINE_SIZE 64
+
+/**
+ * @def STATS_OUTPUT "%-20s %ld\n"
+ * @brief A Macro that sets the output of a single counter of the List Stats.
+ */
+#define STATS_OUTPUT "%-20s %ld\n"
+
 
 /*-----=  Structs  =-----*/
 
 
+/**
+ * A structure for a value to look for or to add, with its length and hash value, which are
+ * computed once for each operation.
+ */
+typedef struct ValueKey
+{
+    char const *value;
+    size_t length;
+    unsigned int hash;
+} ValueKey;
+
 /**
  * A structure for a single Node in the Linked List.
- * It holds the data it contains and a pointer to the next Node.
+ * It holds a pointer to the next Node, the hash value and the length of the data it contains,
+ * the number of pointers to it (from the Heads of Linked Lists and from other Nodes), whether its
+ * data is interned, and the data itself. The data is stored inline right after the Node, so a Node
+ * and its string take a single allocation, unless it is interned, and then the Node holds only a
+ * pointer to the single copy of the string in an Intern Pool. A Node is compared with a value by
+ * the hash value and the length first, and by the data only if both are equal.
+ * A Node with more than one reference is shared by clones of a Linked List, and so are all the
+ * Nodes after it, so they are never changed.
+ * A Node of an ordered Linked List has a number of levels, its height, and the links to the next
+ * Node in each level above the lowest are stored right before it. The other Nodes have a single
+ * level. A Node of a doubly linked Linked List has a link to the previous Node right before it.
  */
 typedef struct Node
 {
-    char *data;
     struct Node *next;
+    unsigned int hash;
+    int length;
+    int references;
+    bool interned;
+    unsigned char height;
+    char data[];
 } Node;
 
+/**
+ * A structure for a single Block of an unrolled Linked List.
+ * It holds a pointer to the next Block, the number of values in this Block, the number of bytes
+ * they take, the number of bytes for values in this Block, the hash value, the length and the
+ * position in the data of each value, and the data itself, where the values are packed with
+ * their string terminators. A scan reads only the arrays of hash values and lengths, and
+ * compares only the values with the same hash value and length. The values are kept in reverse
+ * order, so the first value of the Block is the last one in the arrays and a value is added to
+ * the beginning of the Block in constant time.
+ */
+typedef struct UnrolledBlock
+{
+    struct UnrolledBlock *next;
+    int count;
+    int used;
+    int capacity;
+    unsigned int hashes[BLOCK_CAPACITY];
+    int lengths[BLOCK_CAPACITY];
+    int offsets[BLOCK_CAPACITY];
+    char data[];
+} UnrolledBlock;
+
+/**
+ * A structure for a freed memory block in a Node Pool, which links it to the next freed memory
+ * block of the same size class.
+ */
+typedef struct FreeMemory
+{
+    struct FreeMemory *next;
+} FreeMemory;
+
+/**
+ * A structure for the header of a single Chunk in a Node Pool.
+ * It holds a pointer to the previously allocated Chunk and the number of bytes in this Chunk.
+ * The Nodes of the Chunk are placed right after the header.
+ */
+typedef struct PoolChunk
+{
+    struct PoolChunk *next;
+    size_t capacity;
+} PoolChunk;
+
+/**
+ * A structure for the header of a memory block which is too large for the size classes of a Node
+ * Pool. It holds the pointers to the previous and the next large memory blocks of the same Node
+ * Pool, so a single one can be freed by itself and all of them can be freed with the Node Pool.
+ * The memory block is placed right after the header.
+ */
+typedef struct LargeBlock
+{
+    struct LargeBlock *previous;
+    struct LargeBlock *next;
+} LargeBlock;
+
+/**
+ * A structure for a single string of an Intern Pool.
+ * It holds the number of Nodes which point to it, its hash value and length, and the string
+ * itself.
+ */
+typedef struct InternedString
+{
+    int references;
+    unsigned int hash;
+    int length;
+    char data[];
+} InternedString;
+
+/**
+ * A structure for an Intern Pool, which keeps a single copy of each value of the Linked Lists
+ * which use it, in an open addressing hash table of strings.
+ * It holds the table (NULL for an empty slot), the number of slots in it (a power of 2), the
+ * number of strings, and the number of Node Pools which use it and of its owner.
+ */
+typedef struct _MyInternPool
+{
+    InternedString **strings;
+    int capacity;
+    int numberOfStrings;
+    int references;
+} MyInternPool;
+
+/**
+ * A structure for a Node Pool, which allocates the Nodes, Blocks and values of a Linked List and
+ * of its clones, which share their Nodes with it. It holds the allocated Chunks, the newest first,
+ * the number of bytes taken from the newest Chunk, a list of the freed memory blocks of each size
+ * class which can be taken again, the list of the large memory blocks which are allocated by
+ * themselves, the number of Linked Lists which use it, and the Intern Pool its Nodes point to, or
+ * NULL if their data is stored inline.
+ */
+typedef struct NodePool
+{
+    PoolChunk *chunks;
+    size_t chunkUsed;
+    FreeMemory *freeMemory[NUMBER_OF_SIZE_CLASSES];
+    LargeBlock *largeBlocks;
+    int references;
+    MyInternPool *intern;
+} NodePool;
+
+/**
+ * A structure for a single entry in the Index of a Linked List.
+ * It holds a copy of a value in the Linked List, its hash value and the number of its
+ * occurrences. An entry with a NULL value is empty.
+ */
+typedef struct IndexEntry
+{
+    char *value;
+    unsigned int hash;
+    int count;
+} IndexEntry;
+
+/**
+ * A structure for the Index of a Linked List, an open addressing hash table which maps each value
+ * in the Linked List to the number of its occurrences.
+ * It holds the entries, the number of entries (a power of 2) and the number of values in it.
+ */
+typedef struct ListIndex
+{
+    IndexEntry *entries;
+    int capacity;
+    int numberOfValues;
+} ListIndex;
+
+/**
+ * A structure for a temporary set of values, an open addressing hash table over an array of
+ * values which may contain duplicates.
+ * It holds the Value Keys of the values, the number of removed occurrences of each value, the
+ * table which holds the position of the first of the equal values in the array (or
+ * VALUE_NOT_FOUND for an empty slot) and the number of slots in the table (a power of 2).
+ */
+typedef struct ValueSet
+{
+    ValueKey *keys;
+    int *counts;
+    int *table;
+    int capacity;
+} ValueSet;
+
+/**
+ * A structure for a List Writer, which collects the output of a Linked List in a buffer and
+ * writes it at once, either to a stream, to a file descriptor or to a buffer of the caller.
+ * It holds the buffer, the number of bytes in it, the stream or NULL, the file descriptor or
+ * NO_FILE_DESCRIPTOR, the buffer of the caller and its size when there is neither, the number of
+ * bytes written so far and whether a write failed.
+ */
+typedef struct ListWriter
+{
+    char buffer[WRITE_BUFFER_SIZE];
+    int used;
+    FILE *stream;
+    int fd;
+    char *target;
+    int targetSize;
+    int written;
+    bool failed;
+} ListWriter;
+
+/**
+ * A structure for the header of a saved Linked List file, which is followed by its values.
+ * It holds the LIST_FILE_MAGIC bytes and the number of values.
+ */
+typedef struct ListFileHeader
+{
+    char magic[LIST_FILE_MAGIC_SIZE];
+    int count;
+} ListFileHeader;
+
+/**
+ * A structure for a single value in a saved Linked List file.
+ * It holds the hash value and the length of the value, and the value itself with its terminator,
+ * padded to LIST_FILE_ALIGNMENT bytes. The values are stored in the order of the Linked List.
+ */
+typedef struct ListFileEntry
+{
+    unsigned int hash;
+    int length;
+    char data[];
+} ListFileEntry;
+
+/**
+ * A structure for the lock of a Node in a concurrent Linked List, which is allocated right before
+ * the Node, so the Nodes of a concurrent Linked List are linked exactly as regular Nodes.
+ * It also marks whether the Node was removed, and then links the next Node removed with it,
+ * until they are freed.
+ */
+typedef struct NodeLock
+{
+    pthread_mutex_t mutex;
+    bool removed;
+    Node *nextRemoved;
+} NodeLock;
+
+/**
+ * A structure for the Node Cache of a thread, the memory of the Nodes of concurrent Linked Lists
+ * which the thread freed. Each Node is in the free list of its size class, linked by the next
+ * removed of its Node Lock, until the thread takes it again.
+ */
+typedef struct NodeCache
+{
+    Node *freeNodes[NUMBER_OF_SIZE_CLASSES];
+    int numberOfNodes;
+} NodeCache;
+
+/**
+ * An enum for the ways a Linked List can store its values.
+ * LINKED_MODE stores a single value in each Node, UNROLLED_MODE stores many values packed
+ * in each Block, CONCURRENT_MODE stores a single value in each Node with a lock of its own,
+ * MAPPED_MODE reads the values of a saved Linked List from a read only mapping of its file,
+ * ORDERED_MODE keeps the Nodes sorted in a skip list, and DOUBLY_LINKED_MODE links each Node to
+ * the previous Node too, so a Node can be removed by itself.
+ */
+typedef enum ListMode
+{
+    LINKED_MODE,
+    UNROLLED_MODE,
+    CONCURRENT_MODE,
+    MAPPED_MODE,
+    ORDERED_MODE,
+    DOUBLY_LINKED_MODE
+} ListMode;
+
+/**
+ * An enum for the public functions whose calls are counted in the List Stats.
+ */
+typedef enum ListFunction
+{
+    CREATE_LIST_CALL,
+    CREATE_UNROLLED_LIST_CALL,
+    CREATE_CONCURRENT_LIST_CALL,
+    CREATE_INTERN_POOL_CALL,
+    FREE_INTERN_POOL_CALL,
+    CREATE_INTERNED_LIST_CALL,
+    CREATE_ORDERED_LIST_CALL,
+    CREATE_DOUBLY_LINKED_LIST_CALL,
+    CLONE_LIST_CALL,
+    FREE_LIST_CALL,
+    PRINT_LIST_CALL,
+    WRITE_LIST_CALL,
+    WRITE_LIST_TO_BUFFER_CALL,
+    SAVE_LIST_CALL,
+    MAP_LIST_CALL,
+    LOAD_LIST_CALL,
+    REMOVE_DATA_CALL,
+    INSERT_FIRST_CALL,
+    INSERT_FIRST_NODE_CALL,
+    REMOVE_NODE_CALL,
+    IS_IN_LIST_CALL,
+    GET_SIZE_CALL,
+    GET_SIZE_OF_CALL,
+    INDEX_LIST_CALL,
+    ITERATE_LIST_CALL,
+    NEXT_IN_LIST_CALL,
+    FOLD_LIST_CALL,
+    INSERT_MANY_CALL,
+    REMOVE_MANY_CALL,
+    SORT_LIST_CALL,
+    UNIQUE_LIST_CALL,
+    NUMBER_OF_LIST_FUNCTIONS
+} ListFunction;
+
+/**
+ * A structure for the List Stats, the counters of all the Linked Lists which exist only when the
+ * library is built with STATS.
+ * It holds the number of allocations and frees of the library, the number of bytes they hold now
+ * and at their peak, the number of Nodes and Blocks taken from and returned to Node Pools, the
+ * number of values compared with a stored value and how many of those compared the bytes of the
+ * values, the largest size of a Linked List and the number of calls of each public function.
+ */
+typedef struct ListStats
+{
+    long allocations;
+    long frees;
+    long bytes;
+    long peakBytes;
+    long poolAllocations;
+    long poolFrees;
+    long comparisons;
+    long byteComparisons;
+    long peakSize;
+    long calls[NUMBER_OF_LIST_FUNCTIONS];
+} ListStats;
+
+/**
+ * A union for the header of an allocation counted in the List Stats, which holds its size and is
+ * aligned as any allocation.
+ */
+typedef union AllocationHeader
+{
+    size_t size;
+    long double alignment;
+    void *pointer;
+} AllocationHeader;
+
 /**
  * A structure for a Linked List data structure.
- * It holds the pointer for the first Node, the Head, and a counter for the amount of elements
- * currently in the Linked List.
+ * It holds the way it stores its values, the pointer for the first Node, the Head, or the first
+ * Block in UNROLLED_MODE, a counter for the amount of elements currently in the Linked List, the
+ * number of bytes of its Nodes or Blocks, which is updated by every operation, the Node Pool its
+ * memory is taken from, which it may share with its clones, its Index, which is NULL unless the
+ * Linked List is indexed, the number of scans in each phase of CONCURRENT_MODE, the current
+ * phase and the lock of the phases, the mapping of the file and its size in MAPPED_MODE, and in
+ * ORDERED_MODE the Heads of the levels above the lowest, the number of levels in use and the
+ * state of the random levels.
  */
 typedef struct _MyLinkedList
 {
+    ListMode mode;
     Node *head;
+    UnrolledBlock *firstBlock;
     int size;
+    int bytes;
+    NodePool *pool;
+    ListIndex *index;
+    int readers[READ_PHASES];
+    int readPhase;
+    pthread_mutex_t phaseLock;
+    char const *mapping;
+    size_t mappingSize;
+    Node **skipHeads;
+    int skipHeight;
+    unsigned long long skipRandom;
 } MyLinkedList;
 
 
-/*-----=  Node Functions  =-----*/
+/*-----=  Statistics Functions  =-----*/
+
+
+#ifdef STATS
+/**
+ * The List Stats of all the Linked Lists.
+ */
+static ListStats gListStats;
 
+/**
+ * The names of the public functions in the List Stats output, in the order of ListFunction.
+ */
+static char const * const gListFunctionNames[NUMBER_OF_LIST_FUNCTIONS] = {
+    "createList", "createUnrolledList", "createConcurrentList", "createInternPool",
+    "freeInternPool", "createInternedList", "createOrderedList", "createDoublyLinkedList",
+    "cloneList", "freeList", "printList", "writeList", "writeListToBuffer", "saveList", "mapList",
+    "loadList", "removeData", "insertFirst", "insertFirstNode", "removeNode", "isInList",
+    "getSize", "getSizeOf", "indexList", "iterateList", "nextInList", "foldList", "insertMany",
+    "removeMany", "sortList", "uniqueList"
+};
 
 /**
- * @brief Initialize a given pointer to a Node struct with the default values.
- * @param pNode The pointer to the Node to initialize.
+ * @brief Raises the given peak counter to the given value if it is larger, atomically.
+ * @param pCounter A pointer to the counter.
+ * @param value The value.
  */
-static void initializeNode(Node *pNode)
+static void updateMaximum(long *pCounter, long const value)
 {
-    assert(pNode != NULL);
-    pNode -> data = NULL;
-    pNode -> next = NULL;
+    long current = __atomic_load_n(pCounter, __ATOMIC_RELAXED);
+    while ((value > current) &&
+           !(__atomic_compare_exchange_n(pCounter, &current, value, true, __ATOMIC_RELAXED,
+                                         __ATOMIC_RELAXED)))
+    {
+    }
     return;
 }
 
 /**
- * @brief Frees the memory and resources allocated to the given Node.
- *        If the given Node is NULL, no operation is performed.
- *        The function returns the next Node of the Node we are about to free.
- * @param pNode A pointer to the pointer of the Node to free.
- * @return A pointer to the next Node of the Node we are about to free.
+ * @brief Allocates memory with malloc and counts it in the List Stats. The size is kept in a
+ *        header right before the memory, so countedFree knows how many bytes it frees.
+ * @param size The number of bytes.
+ * @return A pointer to the memory, or NULL if the allocation failed.
  */
-static Node * freeNode(Node *pNode)
+static void * countedMalloc(size_t const size)
 {
-    Node *pNext = NULL;
-    if (pNode != NULL)
+    AllocationHeader *pHeader = (AllocationHeader *)malloc(sizeof(AllocationHeader) + size);
+    if (pHeader == NULL)
     {
-        free(pNode -> data);
-        pNode -> data = NULL;
-
-        pNext = pNode -> next;
-        pNode -> next = NULL;
-
-        free(pNode);
+        return NULL;
     }
-    return pNext;
+    pHeader -> size = size;
+    STATS_ADD(allocations, 1);
+    STATS_MAX(peakBytes, STATS_ADD(bytes, (long)size));
+    return pHeader + 1;
 }
 
 /**
- * @brief Creates a new Node and initialize it with the given data.
- * @param data The data to assign for the new Node.
- * @return A pointer to the new Node that was created and now holding the given data,
- *         or NULL if the allocation failed.
+ * @brief Allocates zeroed memory and counts it in the List Stats.
+ * @param count The number of elements.
+ * @param size The number of bytes of each element.
+ * @return A pointer to the memory, or NULL if the allocation failed.
  */
-static Node * createNode(char const *data)
+static void * countedCalloc(size_t const count, size_t const size)
 {
-    assert(data != NULL);
-
-    Node *pNode = NULL;
-    pNode = (Node *)malloc(sizeof(Node));
-
-    // If the memory allocation was successful, we set this Node's values.
-    if (pNode != NULL)
+    void *pMemory = countedMalloc(count * size);
+    if (pMemory != NULL)
     {
-        initializeNode(pNode);
-
-        // Setting the data value.
-        pNode -> data = (char *)malloc(sizeof(char) * (strlen(data) + STRING_TERMINATOR_COUNT));
-        if ((pNode -> data) != NULL)
-        {
-            memcpy(pNode -> data, data, (sizeof(char) * (strlen(data) + STRING_TERMINATOR_COUNT)));
-        }
-        else
-        {
-            // Unsuccessful Node creation.
-            freeNode(pNode);
-            pNode = NULL;
-        }
-
+        memset(pMemory, 0, count * size);
     }
-    return pNode;
+    return pMemory;
 }
 
 /**
- * @brief Returns the size in bytes of the given Node and all it's contents.
- *		  Equivalent to sum of sizeof for all the Node contents.
- * @param l A pointer to the Node.
- * @return The allocated size for the Node.
+ * @brief Frees memory allocated by countedMalloc and counts it in the List Stats.
+ * @param pMemory A pointer to the memory, or NULL.
  */
-int getSizeOfNode(Node * const pNode)
+static void countedFree(void *pMemory)
 {
-    int sizeOf = NO_ALLOCATE_SIZE;
-    if (pNode != NULL)
+    if (pMemory != NULL)
     {
-        sizeOf += sizeof(Node);
-        sizeOf += sizeof(char) * (strlen(pNode -> data) + STRING_TERMINATOR_COUNT);
+        AllocationHeader *pHeader = (AllocationHeader *)pMemory - 1;
+        STATS_ADD(frees, 1);
+        STATS_ADD(bytes, -(long)(pHeader -> size));
+        free(pHeader);
     }
-    return sizeOf;
+    return;
 }
 
-
-/*-----=  Linked List Functions  =-----*/
-
-
 /**
- * @brief Initialize a given pointer to a Linked List struct with the default values.
- * @param pMyLinkedList The pointer to the Linked List to initialize.
+ * @brief Compares bytes with memcmp and counts it in the List Stats.
+ * @param pFirst A pointer to the first bytes.
+ * @param pSecond A pointer to the second bytes.
+ * @param count The number of bytes.
+ * @return The result of memcmp.
  */
-static void initializeList(MyLinkedListP pMyLinkedList)
+static int countedMemcmp(void const *pFirst, void const *pSecond, size_t const count)
 {
-    assert(pMyLinkedList != NULL);
-    pMyLinkedList -> head = NULL;
-    pMyLinkedList -> size = EMPTY_LIST_SIZE;
-    return;
+    STATS_ADD(byteComparisons, 1);
+    return memcmp(pFirst, pSecond, count);
 }
 
 /**
- * @brief Allocates a new empty Linked List.
- * 		  It is the caller's responsibility to free the returned Linked List.
- * @return A pointer to the new Linked List, or NULL if the allocation failed.
+ * @brief Compares strings with strcmp and counts it in the List Stats.
+ * @param first The first string.
+ * @param second The second string.
+ * @return The result of strcmp.
+ */
+static int countedStrcmp(char const *first, char const *second)
+{
+    STATS_ADD(byteComparisons, 1);
+    return strcmp(first, second);
+}
+
+// From here on, the library allocates, frees and compares bytes through the counted functions.
+#define malloc(size) countedMalloc(size)
+#define calloc(count, size) countedCalloc(count, size)
+#define free(pMemory) countedFree(pMemory)
+#define memcmp(pFirst, pSecond, count) countedMemcmp(pFirst, pSecond, count)
+#define strcmp(first, second) countedStrcmp(first, second)
+#endif
+
+
+/*-----=  Intern Pool Functions  =-----*/
+
+
+/**
+ * @brief Gets the interned string which holds the given value.
+ * @param value The value, which is the data of an interned string.
+ * @return A pointer to the interned string.
+ */
+static InternedString * getInternedString(char const *value)
+{
+    return (InternedString *)(value - offsetof(InternedString, data));
+}
+
+/**
+ * @brief Finds the slot of the given value in the table of the given Intern Pool.
+ * @param pIntern A pointer to the Intern Pool.
+ * @param pKey A pointer to the Value Key of the value.
+ * @return The slot which holds the value, or the empty slot it should be put in.
+ */
+static int findInternedString(MyInternPool const *pIntern, ValueKey const *pKey)
+{
+    int const mask = pIntern -> capacity - 1;
+    int position = pKey -> hash & mask;
+    InternedString const *pString = pIntern -> strings[position];
+    while (pString != NULL)
+    {
+        STATS_ADD(comparisons, 1);
+        if ((pString -> hash == pKey -> hash) && ((size_t)pString -> length == pKey -> length) &&
+            (memcmp(pString -> data, pKey -> value, pKey -> length) == STRING_EQUALITY))
+        {
+            break;
+        }
+        position = (position + 1) & mask;
+        pString = pIntern -> strings[position];
+    }
+    return position;
+}
+
+/**
+ * @brief Doubles the number of slots in the table of the given Intern Pool.
+ * @param pIntern A pointer to the Intern Pool.
+ * @return true iff succeed. If the allocation failed, the Intern Pool is not changed.
+ */
+static bool growInternPool(MyInternPool *pIntern)
+{
+    int const capacity = pIntern -> capacity * INDEX_GROWTH_FACTOR;
+    InternedString **strings = (InternedString **)calloc(capacity, sizeof(InternedString *));
+    if (strings == NULL)
+    {
+        return false;
+    }
+    InternedString **oldStrings = pIntern -> strings;
+    int const oldCapacity = pIntern -> capacity;
+    pIntern -> strings = strings;
+    pIntern -> capacity = capacity;
+
+    int i = 0;
+    while (i < oldCapacity)
+    {
+        if (oldStrings[i] != NULL)
+        {
+            int position = oldStrings[i] -> hash & (capacity - 1);
+            while (strings[position] != NULL)
+            {
+                position = (position + 1) & (capacity - 1);
+            }
+            strings[position] = oldStrings[i];
+        }
+        i++;
+    }
+    free(oldStrings);
+    return true;
+}
+
+/**
+ * @brief Gets the single copy of the given value in the given Intern Pool, and adds a reference
+ *        to it. The copy is made by the first call with the value.
+ * @param pIntern A pointer to the Intern Pool.
+ * @param pKey A pointer to the Value Key of the value.
+ * @return A pointer to the copy, or NULL if the allocation failed.
+ */
+static char const * internValue(MyInternPool *pIntern, ValueKey const *pKey)
+{
+    int position = findInternedString(pIntern, pKey);
+    if (pIntern -> strings[position] == NULL)
+    {
+        // The table is kept at most INDEX_LOAD_NUMERATOR / INDEX_LOAD_DENOMINATOR full.
+        if (((pIntern -> numberOfStrings + 1) * INDEX_LOAD_DENOMINATOR >
+             pIntern -> capacity * INDEX_LOAD_NUMERATOR))
+        {
+            if (!growInternPool(pIntern))
+            {
+                return NULL;
+            }
+            position = findInternedString(pIntern, pKey);
+        }
+        InternedString *pString = (InternedString *)malloc(sizeof(InternedString) +
+                                                           pKey -> length +
+                                                           STRING_TERMINATOR_COUNT);
+        if (pString == NULL)
+        {
+            return NULL;
+        }
+        pString -> references = 0;
+        pString -> hash = pKey -> hash;
+        pString -> length = (int)pKey -> length;
+        memcpy(pString -> data, pKey -> value, pKey -> length + STRING_TERMINATOR_COUNT);
+        pIntern -> strings[position] = pString;
+        (pIntern -> numberOfStrings)++;
+    }
+    (pIntern -> strings[position] -> references)++;
+    return pIntern -> strings[position] -> data;
+}
+
+/**
+ * @brief Looks up the single copy of the given value in the given Intern Pool, without adding a
+ *        reference to it.
+ * @param pIntern A pointer to the Intern Pool.
+ * @param pKey A pointer to the Value Key of the value.
+ * @return A pointer to the copy, or NULL if no Node holds the value.
+ */
+static char const * lookupValue(MyInternPool const *pIntern, ValueKey const *pKey)
+{
+    InternedString const *pString = pIntern -> strings[findInternedString(pIntern, pKey)];
+    return (pString != NULL) ? pString -> data : NULL;
+}
+
+/**
+ * @brief Removes a reference to the given interned value, and frees it with the last reference.
+ * @param pIntern A pointer to the Intern Pool of the value.
+ * @param value The value, which was returned by internValue.
+ */
+static void releaseValue(MyInternPool *pIntern, char const *value)
+{
+    InternedString *pString = getInternedString(value);
+    assert(pString -> references > 0);
+    (pString -> references)--;
+    if (pString -> references > 0)
+    {
+        return;
+    }
+
+    int const mask = pIntern -> capacity - 1;
+    int emptyPosition = pString -> hash & mask;
+    while (pIntern -> strings[emptyPosition] != pString)
+    {
+        emptyPosition = (emptyPosition + 1) & mask;
+    }
+    free(pString);
+    pIntern -> strings[emptyPosition] = NULL;
+    (pIntern -> numberOfStrings)--;
+
+    // The strings after the removed one are moved back, so no lookup stops at its empty slot.
+    int position = (emptyPosition + 1) & mask;
+    while (pIntern -> strings[position] != NULL)
+    {
+        int const home = pIntern -> strings[position] -> hash & mask;
+        if (((position - home) & mask) >= ((position - emptyPosition) & mask))
+        {
+            pIntern -> strings[emptyPosition] = pIntern -> strings[position];
+            pIntern -> strings[position] = NULL;
+            emptyPosition = position;
+        }
+        position = (position + 1) & mask;
+    }
+    return;
+}
+
+/**
+ * @brief Removes a reference to the given Intern Pool, and frees it with the last reference.
+ *        All the Nodes which point to its strings are freed before, so no string is left.
+ *        If the given Intern Pool is NULL, no operation is performed.
+ * @param pIntern A pointer to the Intern Pool.
+ */
+static void releaseInternPool(MyInternPool *pIntern)
+{
+    if (pIntern == NULL)
+    {
+        return;
+    }
+    assert(pIntern -> references > 0);
+    (pIntern -> references)--;
+    if (pIntern -> references == 0)
+    {
+        assert(pIntern -> numberOfStrings == 0);
+        free(pIntern -> strings);
+        free(pIntern);
+    }
+    return;
+}
+
+
+/*-----=  Node Pool Functions  =-----*/
+
+
+/**
+ * @brief Initialize a given pointer to a Node Pool struct with the default values.
+ * @param pPool The pointer to the Node Pool to initialize.
+ */
+static void initializePool(NodePool *pPool)
+{
+    assert(pPool != NULL);
+    pPool -> chunks = NULL;
+    pPool -> chunkUsed = NO_ALLOCATE_SIZE;
+    int i = 0;
+    while (i < NUMBER_OF_SIZE_CLASSES)
+    {
+        pPool -> freeMemory[i] = NULL;
+        i++;
+    }
+    pPool -> largeBlocks = NULL;
+    return;
+}
+
+/**
+ * @brief Gets the size class of a memory block of the given size.
+ * @param size The number of bytes in the memory block.
+ * @return The size class of the memory block, or LARGE_SIZE_CLASS if it is too large for the
+ *         size classes.
+ */
+static int getSizeClass(size_t const size)
+{
+    size_t const sizeClass = (size - 1) / SIZE_CLASS_GRANULARITY;
+    return (sizeClass < NUMBER_OF_SIZE_CLASSES) ? (int)sizeClass : LARGE_SIZE_CLASS;
+}
+
+/**
+ * @brief Gets the number of bytes a memory block of the given size takes from the Chunks of a
+ *        Node Pool.
+ * @param size The number of bytes in the memory block.
+ * @return The number of bytes taken from the Chunks, or NO_ALLOCATE_SIZE for a large memory
+ *         block which is allocated by itself.
+ */
+static size_t getPooledSize(size_t const size)
+{
+    int const sizeClass = getSizeClass(size);
+    return (sizeClass == LARGE_SIZE_CLASS) ? NO_ALLOCATE_SIZE :
+           (size_t)(sizeClass + 1) * SIZE_CLASS_GRANULARITY;
+}
+
+/**
+ * @brief Makes sure the newest Chunk of the given Node Pool has at least the given number of free
+ *        bytes, so memory blocks of that total size can be taken one after the other without
+ *        another allocation. If it does not, a new Chunk is allocated, larger than the previous
+ *        one up to MAX_CHUNK_SIZE bytes, or as large as the requested size if it is larger.
+ * @param pPool The pointer to the Node Pool.
+ * @param size The number of bytes to reserve.
+ * @return true iff succeed.
+ */
+static bool reservePool(NodePool *pPool, size_t const size)
+{
+    assert(pPool != NULL);
+
+    PoolChunk *pChunk = pPool -> chunks;
+    if ((pChunk != NULL) && (pPool -> chunkUsed + size <= pChunk -> capacity))
+    {
+        return true;
+    }
+
+    size_t capacity = FIRST_CHUNK_SIZE;
+    if (pChunk != NULL)
+    {
+        capacity = pChunk -> capacity * CHUNK_GROWTH_FACTOR;
+        capacity = (capacity > MAX_CHUNK_SIZE) ? MAX_CHUNK_SIZE : capacity;
+    }
+    capacity = (capacity < size) ? size : capacity;
+
+    pChunk = (PoolChunk *)malloc(sizeof(PoolChunk) + capacity);
+    if (pChunk == NULL)
+    {
+        return false;
+    }
+    pChunk -> next = pPool -> chunks;
+    pChunk -> capacity = capacity;
+    pPool -> chunks = pChunk;
+    pPool -> chunkUsed = NO_ALLOCATE_SIZE;
+    return true;
+}
+
+/**
+ * @brief Allocates a memory block which is too large for the size classes by itself, and links
+ *        it to the large memory blocks of the given Node Pool.
+ * @param pPool The pointer to the Node Pool.
+ * @param size The number of bytes in the memory block.
+ * @return A pointer to the memory block, or NULL if the allocation failed.
+ */
+static void * allocateLargeMemory(NodePool *pPool, size_t const size)
+{
+    LargeBlock *pBlock = (LargeBlock *)malloc(sizeof(LargeBlock) + size);
+    if (pBlock == NULL)
+    {
+        return NULL;
+    }
+    pBlock -> previous = NULL;
+    pBlock -> next = pPool -> largeBlocks;
+    if (pPool -> largeBlocks != NULL)
+    {
+        pPool -> largeBlocks -> previous = pBlock;
+    }
+    pPool -> largeBlocks = pBlock;
+    return pBlock + 1;
+}
+
+/**
+ * @brief Takes a memory block of the given size from the given Node Pool.
+ *        Freed memory blocks of the same size class are taken first, otherwise the memory block
+ *        is taken from the newest Chunk, and a new Chunk is allocated if it is full.
+ * @param pPool The pointer to the Node Pool.
+ * @param size The number of bytes in the memory block.
+ * @return A pointer to the memory block, or NULL if the allocation failed.
+ */
+static void * allocateMemory(NodePool *pPool, size_t const size)
+{
+    assert(pPool != NULL);
+
+    STATS_ADD(poolAllocations, 1);
+    int const sizeClass = getSizeClass(size);
+    if (sizeClass == LARGE_SIZE_CLASS)
+    {
+        return allocateLargeMemory(pPool, size);
+    }
+
+    FreeMemory *pMemory = pPool -> freeMemory[sizeClass];
+    if (pMemory != NULL)
+    {
+        pPool -> freeMemory[sizeClass] = pMemory -> next;
+        return pMemory;
+    }
+
+    size_t const pooledSize = getPooledSize(size);
+    if (!reservePool(pPool, pooledSize))
+    {
+        return NULL;
+    }
+    void *pBytes = (char *)(pPool -> chunks + 1) + pPool -> chunkUsed;
+    pPool -> chunkUsed += pooledSize;
+    return pBytes;
+}
+
+/**
+ * @brief Returns a given memory block of the given size to the given Node Pool, so it can be
+ *        taken again. A large memory block is freed immediately.
+ * @param pPool The pointer to the Node Pool.
+ * @param pBytes The pointer to the memory block to return.
+ * @param size The number of bytes in the memory block.
+ */
+static void deallocateMemory(NodePool *pPool, void *pBytes, size_t const size)
+{
+    assert(pPool != NULL);
+    assert(pBytes != NULL);
+
+    STATS_ADD(poolFrees, 1);
+    int const sizeClass = getSizeClass(size);
+    if (sizeClass == LARGE_SIZE_CLASS)
+    {
+        LargeBlock *pBlock = (LargeBlock *)pBytes - 1;
+        if (pBlock -> previous != NULL)
+        {
+            pBlock -> previous -> next = pBlock -> next;
+        }
+        else
+        {
+            pPool -> largeBlocks = pBlock -> next;
+        }
+        if (pBlock -> next != NULL)
+        {
+            pBlock -> next -> previous = pBlock -> previous;
+        }
+        free(pBlock);
+        return;
+    }
+    FreeMemory *pMemory = (FreeMemory *)pBytes;
+    pMemory -> next = pPool -> freeMemory[sizeClass];
+    pPool -> freeMemory[sizeClass] = pMemory;
+    return;
+}
+
+/**
+ * @brief Frees all the Chunks and all the large memory blocks of the given Node Pool at once.
+ * @param pPool The pointer to the Node Pool to free.
+ */
+static void freePool(NodePool *pPool)
+{
+    assert(pPool != NULL);
+    PoolChunk *pChunk = pPool -> chunks;
+    while (pChunk != NULL)
+    {
+        PoolChunk *pNext = pChunk -> next;
+        free(pChunk);
+        pChunk = pNext;
+    }
+    LargeBlock *pBlock = pPool -> largeBlocks;
+    while (pBlock != NULL)
+    {
+        LargeBlock *pNext = pBlock -> next;
+        free(pBlock);
+        pBlock = pNext;
+    }
+    initializePool(pPool);
+    return;
+}
+
+/**
+ * @brief Allocates a new empty Node Pool, which is used by a single Linked List.
+ * @return A pointer to the new Node Pool, or NULL if the allocation failed.
+ */
+static NodePool * createPool()
+{
+    NodePool *pPool = (NodePool *)malloc(sizeof(NodePool));
+    if (pPool != NULL)
+    {
+        initializePool(pPool);
+        pPool -> references = 1;
+        pPool -> intern = NULL;
+    }
+    return pPool;
+}
+
+/**
+ * @brief Releases the given Node Pool from a Linked List which does not use it anymore, and
+ *        frees it if no other Linked List uses it.
+ * @param pPool The pointer to the Node Pool to release.
+ */
+static void releasePool(NodePool *pPool)
+{
+    assert((pPool != NULL) && (pPool -> references > 0));
+    (pPool -> references)--;
+    if (pPool -> references == 0)
+    {
+        freePool(pPool);
+        releaseInternPool(pPool -> intern);
+        free(pPool);
+    }
+    return;
+}
+
+
+/*-----=  Value Key Functions  =-----*/
+
+
+/**
+ * @brief Computes the hash value of a given string (djb2).
+ * @param value The string to hash.
+ * @return The hash value of the string.
+ */
+static unsigned int hashString(char const *value)
+{
+    assert(value != NULL);
+    unsigned int hash = HASH_INITIAL_VALUE;
+    while (*value != '\0')
+    {
+        hash = ((hash << HASH_SHIFT) + hash) + (unsigned char)(*value);
+        value++;
+    }
+    return hash;
+}
+
+/**
+ * @brief Creates the Value Key of the given value, with its length and hash value.
+ * @param value The value.
+ * @return The Value Key of the value.
+ */
+static ValueKey createKey(char const *value)
+{
+    assert(value != NULL);
+    ValueKey key;
+    key.value = value;
+    key.length = strlen(value);
+    key.hash = hashString(value);
+    return key;
+}
+
+
+/**
+ * @brief Checks if the given values are equal, by their hash values and lengths first.
+ * @param pFirst A pointer to the Value Key of the first value.
+ * @param pSecond A pointer to the Value Key of the second value.
+ * @return true iff the values are equal.
+ */
+static bool isKeyEqual(ValueKey const *pFirst, ValueKey const *pSecond)
+{
+    STATS_ADD(comparisons, 1);
+    return (pFirst -> hash == pSecond -> hash) && (pFirst -> length == pSecond -> length) &&
+           (memcmp(pFirst -> value, pSecond -> value, pFirst -> length) == STRING_EQUALITY);
+}
+
+
+/*-----=  Node Functions  =-----*/
+
+
+/**
+ * @brief Gets the number of bytes in a Node which holds a string of the given length.
+ * @param length The length of the string.
+ * @return The number of bytes in the Node.
+ */
+static size_t getNodeSize(size_t const length)
+{
+    return sizeof(Node) + (sizeof(char) * (length + STRING_TERMINATOR_COUNT));
+}
+
+/**
+ * @brief Gets the data of the given Node, which is either stored in it or interned.
+ * @param pNode A pointer to the Node.
+ * @return The data of the Node.
+ */
+static char const * getNodeValue(Node const *pNode)
+{
+    if (!(pNode -> interned))
+    {
+        return pNode -> data;
+    }
+    char const *value = NULL;
+    memcpy(&value, pNode -> data, sizeof(value));
+    return value;
+}
+
+/**
+ * @brief Frees the memory and resources allocated to the given Node, and returns the Node to the
+ *        given Node Pool. The reference of an interned Node to its string is removed.
+ *        If the given Node is NULL, no operation is performed.
+ *        The function returns the next Node of the Node we are about to free.
+ * @param pPool A pointer to the Node Pool the Node was taken from.
+ * @param pNode A pointer to the pointer of the Node to free.
+ * @return A pointer to the next Node of the Node we are about to free.
+ */
+static Node * freeNode(NodePool *pPool, Node *pNode)
+{
+    Node *pNext = NULL;
+    if (pNode != NULL)
+    {
+        pNext = pNode -> next;
+        if (pNode -> interned)
+        {
+            releaseValue(pPool -> intern, getNodeValue(pNode));
+            deallocateMemory(pPool, pNode, INTERNED_NODE_SIZE);
+        }
+        else
+        {
+            deallocateMemory(pPool, pNode, getNodeSize(pNode -> length));
+        }
+    }
+    return pNext;
+}
+
+/**
+ * @brief Initialize the given Node with the given data.
+ *        The data is copied into the Node itself, with its length and hash value.
+ * @param pNode A pointer to the Node to initialize.
+ * @param pKey A pointer to the Value Key of the data to assign for the Node.
+ */
+static void initializeNode(Node *pNode, ValueKey const *pKey)
+{
+    pNode -> next = NULL;
+    pNode -> hash = pKey -> hash;
+    pNode -> length = (int)pKey -> length;
+    pNode -> references = 1;
+    pNode -> interned = false;
+    pNode -> height = 1;
+    memcpy(pNode -> data, pKey -> value,
+           (sizeof(char) * (pKey -> length + STRING_TERMINATOR_COUNT)));
+    return;
+}
+
+/**
+ * @brief Creates a new Node which points to the single copy of the given data in the Intern Pool
+ *        of the given Node Pool.
+ * @param pPool A pointer to the Node Pool to take the Node from.
+ * @param pKey A pointer to the Value Key of the data to assign for the new Node.
+ * @return A pointer to the new Node, or NULL if the allocation failed.
+ */
+static Node * createInternedNode(NodePool *pPool, ValueKey const *pKey)
+{
+    char const *value = internValue(pPool -> intern, pKey);
+    if (value == NULL)
+    {
+        return NULL;
+    }
+    Node *pNode = (Node *)allocateMemory(pPool, INTERNED_NODE_SIZE);
+    if (pNode == NULL)
+    {
+        releaseValue(pPool -> intern, value);
+        return NULL;
+    }
+    pNode -> next = NULL;
+    pNode -> hash = pKey -> hash;
+    pNode -> length = (int)pKey -> length;
+    pNode -> references = 1;
+    pNode -> interned = true;
+    pNode -> height = 1;
+    memcpy(pNode -> data, &value, sizeof(value));
+    return pNode;
+}
+
+/**
+ * @brief Creates a new Node from the given Node Pool and initialize it with the given data.
+ *        If the Node Pool has an Intern Pool, the Node points to the interned data.
+ * @param pPool A pointer to the Node Pool to take the Node from.
+ * @param pKey A pointer to the Value Key of the data to assign for the new Node.
+ * @return A pointer to the new Node that was created and now holding the given data,
+ *         or NULL if the allocation failed.
+ */
+static Node * createNode(NodePool *pPool, ValueKey const *pKey)
+{
+    assert((pKey != NULL) && (pKey -> value != NULL));
+
+    if (pPool -> intern != NULL)
+    {
+        return createInternedNode(pPool, pKey);
+    }
+    Node *pNode = (Node *)allocateMemory(pPool, getNodeSize(pKey -> length));
+
+    // If the memory allocation was successful, we set this Node's values.
+    if (pNode != NULL)
+    {
+        initializeNode(pNode, pKey);
+    }
+    return pNode;
+}
+
+/**
+ * @brief Gets the Value Key of the data of the given Node, from the length and hash value stored
+ *        in it.
+ * @param pNode A pointer to the Node.
+ * @return The Value Key of the data.
+ */
+static ValueKey getNodeKey(Node const *pNode)
+{
+    ValueKey key;
+    key.value = getNodeValue(pNode);
+    key.length = pNode -> length;
+    key.hash = pNode -> hash;
+    return key;
+}
+
+/**
+ * @brief Checks if the data of the given Node is equal to the given value.
+ * @param pNode A pointer to the Node.
+ * @param pKey A pointer to the Value Key of the value.
+ * @return true iff the data is equal to the value.
+ */
+static bool isNodeEqual(Node const *pNode, ValueKey const *pKey)
+{
+    STATS_ADD(comparisons, 1);
+    return (pNode -> hash == pKey -> hash) && ((size_t)pNode -> length == pKey -> length) &&
+           (memcmp(getNodeValue(pNode), pKey -> value, pKey -> length) == STRING_EQUALITY);
+}
+
+/**
+ * @brief Returns the size in bytes of the given Node and all it's contents.
+ *		  Equivalent to sum of sizeof for all the Node contents. An interned Node holds only a
+ *		  pointer to its string, which belongs to the Intern Pool.
+ * @param l A pointer to the Node.
+ * @return The allocated size for the Node.
+ */
+int getSizeOfNode(Node * const pNode)
+{
+    int sizeOf = NO_ALLOCATE_SIZE;
+    if (pNode != NULL)
+    {
+        if (pNode -> interned)
+        {
+            sizeOf += INTERNED_NODE_SIZE;
+        }
+        else
+        {
+            sizeOf += sizeof(Node);
+            sizeOf += sizeof(char) * (pNode -> length + STRING_TERMINATOR_COUNT);
+        }
+    }
+    return sizeOf;
+}
+
+
+/*-----=  Index Functions  =-----*/
+
+
+/**
+ * @brief Allocates a new empty Index with the given number of entries.
+ * @param capacity The number of entries, a power of 2.
+ * @return A pointer to the new Index, or NULL if the allocation failed.
+ */
+static ListIndex * createIndex(int const capacity)
+{
+    ListIndex *pIndex = (ListIndex *)malloc(sizeof(ListIndex));
+    if (pIndex == NULL)
+    {
+        return NULL;
+    }
+    pIndex -> entries = (IndexEntry *)calloc(capacity, sizeof(IndexEntry));
+    if (pIndex -> entries == NULL)
+    {
+        free(pIndex);
+        return NULL;
+    }
+    pIndex -> capacity = capacity;
+    pIndex -> numberOfValues = EMPTY_LIST_SIZE;
+    return pIndex;
+}
+
+/**
+ * @brief Frees the memory and resources allocated to the given Index.
+ *        If the given Index is NULL, no operation is performed.
+ * @param pIndex A pointer to the Index to free.
+ */
+static void freeIndex(ListIndex *pIndex)
+{
+    if (pIndex != NULL)
+    {
+        int i = 0;
+        while (i < pIndex -> capacity)
+        {
+            free(pIndex -> entries[i].value);
+            i++;
+        }
+        free(pIndex -> entries);
+        free(pIndex);
+    }
+    return;
+}
+
+/**
+ * @brief Finds the entry of the given value in the given Index.
+ * @param pIndex A pointer to the Index.
+ * @param value The value to find.
+ * @param hash The hash value of the value.
+ * @return The position of the entry of the value, or of the empty entry where it should be added
+ *         if the value is not in the Index.
+ */
+static int findIndexEntry(ListIndex const *pIndex, char const *value, unsigned int const hash)
+{
+    int const mask = pIndex -> capacity - 1;
+    int position = hash & mask;
+    while (pIndex -> entries[position].value != NULL)
+    {
+        STATS_ADD(comparisons, 1);
+        IndexEntry const *pEntry = &(pIndex -> entries[position]);
+        if ((pEntry -> hash == hash) && (strcmp(pEntry -> value, value) == STRING_EQUALITY))
+        {
+            break;
+        }
+        position = (position + 1) & mask;
+    }
+    return position;
+}
+
+/**
+ * @brief Doubles the number of entries of the given Index, and moves all its values to their new
+ *        entries.
+ * @param pIndex A pointer to the Index.
+ * @return true iff succeed.
+ */
+static bool growIndex(ListIndex *pIndex)
+{
+    int const capacity = pIndex -> capacity * INDEX_GROWTH_FACTOR;
+    IndexEntry *entries = (IndexEntry *)calloc(capacity, sizeof(IndexEntry));
+    if (entries == NULL)
+    {
+        return false;
+    }
+    IndexEntry *oldEntries = pIndex -> entries;
+    int const oldCapacity = pIndex -> capacity;
+    pIndex -> entries = entries;
+    pIndex -> capacity = capacity;
+
+    int i = 0;
+    while (i < oldCapacity)
+    {
+        if (oldEntries[i].value != NULL)
+        {
+            int const position = findIndexEntry(pIndex, oldEntries[i].value, oldEntries[i].hash);
+            entries[position] = oldEntries[i];
+        }
+        i++;
+    }
+    free(oldEntries);
+    return true;
+}
+
+/**
+ * @brief Adds a single occurrence of the given value to the given Index.
+ * @param pIndex A pointer to the Index.
+ * @param pKey A pointer to the Value Key of the value to add.
+ * @return true iff succeed.
+ */
+static bool addToIndex(ListIndex *pIndex, ValueKey const *pKey)
+{
+    assert((pIndex != NULL) && (pKey != NULL));
+
+    char const *value = pKey -> value;
+    unsigned int const hash = pKey -> hash;
+    int position = findIndexEntry(pIndex, value, hash);
+    if (pIndex -> entries[position].value != NULL)
+    {
+        (pIndex -> entries[position].count)++;
+        return true;
+    }
+
+    if ((pIndex -> numberOfValues + 1) * INDEX_LOAD_DENOMINATOR >
+        pIndex -> capacity * INDEX_LOAD_NUMERATOR)
+    {
+        if (!growIndex(pIndex))
+        {
+            return false;
+        }
+        position = findIndexEntry(pIndex, value, hash);
+    }
+
+    size_t const size = sizeof(char) * (pKey -> length + STRING_TERMINATOR_COUNT);
+    char *copy = (char *)malloc(size);
+    if (copy == NULL)
+    {
+        return false;
+    }
+    memcpy(copy, value, size);
+    pIndex -> entries[position].value = copy;
+    pIndex -> entries[position].hash = hash;
+    pIndex -> entries[position].count = 1;
+    (pIndex -> numberOfValues)++;
+    return true;
+}
+
+/**
+ * @brief Gets the number of occurrences of the given value in the given Index.
+ * @param pIndex A pointer to the Index.
+ * @param pKey A pointer to the Value Key of the value to count.
+ * @return The number of occurrences of the value.
+ */
+static int countInIndex(ListIndex const *pIndex, ValueKey const *pKey)
+{
+    assert((pIndex != NULL) && (pKey != NULL));
+    int const position = findIndexEntry(pIndex, pKey -> value, pKey -> hash);
+    return (pIndex -> entries[position].value != NULL) ? pIndex -> entries[position].count :
+           NO_OCCURRENCES;
+}
+
+/**
+ * @brief Removes the given number of occurrences of the given value from the given Index. The
+ *        value is removed from the Index when no occurrences are left, and the following entries
+ *        of the same probe sequence are shifted back into its entry, so no deleted markers are
+ *        needed.
+ * @param pIndex A pointer to the Index.
+ * @param pKey A pointer to the Value Key of the value to remove.
+ * @param count The number of occurrences to remove.
+ */
+static void removeFromIndex(ListIndex *pIndex, ValueKey const *pKey, int const count)
+{
+    assert((pIndex != NULL) && (pKey != NULL));
+
+    int const mask = pIndex -> capacity - 1;
+    int emptyPosition = findIndexEntry(pIndex, pKey -> value, pKey -> hash);
+    if (pIndex -> entries[emptyPosition].value == NULL)
+    {
+        return;
+    }
+    pIndex -> entries[emptyPosition].count -= count;
+    if (pIndex -> entries[emptyPosition].count > NO_OCCURRENCES)
+    {
+        return;
+    }
+    free(pIndex -> entries[emptyPosition].value);
+    pIndex -> entries[emptyPosition].value = NULL;
+    (pIndex -> numberOfValues)--;
+
+    int position = (emptyPosition + 1) & mask;
+    while (pIndex -> entries[position].value != NULL)
+    {
+        int const home = pIndex -> entries[position].hash & mask;
+        if (((position - home) & mask) >= ((position - emptyPosition) & mask))
+        {
+            pIndex -> entries[emptyPosition] = pIndex -> entries[position];
+            pIndex -> entries[position].value = NULL;
+            emptyPosition = position;
+        }
+        position = (position + 1) & mask;
+    }
+    return;
+}
+
+/**
+ * @brief Allocates a copy of the given Index.
+ * @param pIndex A pointer to the Index to copy.
+ * @return A pointer to the copy, or NULL if the allocation failed.
+ */
+static ListIndex * cloneIndex(ListIndex const *pIndex)
+{
+    ListIndex *pCopy = createIndex(pIndex -> capacity);
+    if (pCopy == NULL)
+    {
+        return NULL;
+    }
+    int i = 0;
+    while (i < pIndex -> capacity)
+    {
+        IndexEntry const *pEntry = &(pIndex -> entries[i]);
+        if (pEntry -> value != NULL)
+        {
+            size_t const size = sizeof(char) * (strlen(pEntry -> value) + STRING_TERMINATOR_COUNT);
+            pCopy -> entries[i] = *pEntry;
+            pCopy -> entries[i].value = (char *)malloc(size);
+            if (pCopy -> entries[i].value == NULL)
+            {
+                freeIndex(pCopy);
+                return NULL;
+            }
+            memcpy(pCopy -> entries[i].value, pEntry -> value, size);
+        }
+        i++;
+    }
+    pCopy -> numberOfValues = pIndex -> numberOfValues;
+    return pCopy;
+}
+
+
+/*-----=  Value Set Functions  =-----*/
+
+
+/**
+ * @brief Frees the memory and resources allocated to the given Value Set.
+ * @param pSet A pointer to the Value Set to free.
+ */
+static void freeValueSet(ValueSet *pSet)
+{
+    free(pSet -> keys);
+    free(pSet -> counts);
+    free(pSet -> table);
+    pSet -> keys = NULL;
+    pSet -> counts = NULL;
+    pSet -> table = NULL;
+    return;
+}
+
+/**
+ * @brief Finds the position of the given value in the array of the given Value Set.
+ * @param pSet A pointer to the Value Set.
+ * @param pKey A pointer to the Value Key of the value to find.
+ * @param pSlot A pointer to store the slot of the value in the table, or the empty slot where it
+ *        should be added.
+ * @return The position of the first of the equal values in the array, or VALUE_NOT_FOUND.
+ */
+static int findInValueSet(ValueSet const *pSet, ValueKey const *pKey, int *pSlot)
+{
+    int const mask = pSet -> capacity - 1;
+    int slot = pKey -> hash & mask;
+    while (pSet -> table[slot] != VALUE_NOT_FOUND)
+    {
+        STATS_ADD(comparisons, 1);
+        ValueKey const *pCurrent = &(pSet -> keys[pSet -> table[slot]]);
+        if ((pCurrent -> hash == pKey -> hash) && (pCurrent -> length == pKey -> length) &&
+            (memcmp(pCurrent -> value, pKey -> value, pKey -> length) == STRING_EQUALITY))
+        {
+            break;
+        }
+        slot = (slot + 1) & mask;
+    }
+    if (pSlot != NULL)
+    {
+        *pSlot = slot;
+    }
+    return pSet -> table[slot];
+}
+
+/**
+ * @brief Builds a Value Set of the given values.
+ * @param pSet A pointer to the Value Set to build.
+ * @param vals The values.
+ * @param k The number of values.
+ * @return true iff succeed.
+ */
+static bool createValueSet(ValueSet *pSet, char const * const *vals, int const k)
+{
+    pSet -> capacity = INITIAL_INDEX_CAPACITY;
+    while (pSet -> capacity * INDEX_LOAD_NUMERATOR < k * INDEX_LOAD_DENOMINATOR)
+    {
+        pSet -> capacity *= INDEX_GROWTH_FACTOR;
+    }
+    pSet -> keys = (ValueKey *)malloc(sizeof(ValueKey) * (k + 1));
+    pSet -> counts = (int *)calloc(k + 1, sizeof(int));
+    pSet -> table = (int *)malloc(sizeof(int) * pSet -> capacity);
+    if ((pSet -> keys == NULL) || (pSet -> counts == NULL) || (pSet -> table == NULL))
+    {
+        freeValueSet(pSet);
+        return false;
+    }
+
+    int i = 0;
+    while (i < pSet -> capacity)
+    {
+        pSet -> table[i] = VALUE_NOT_FOUND;
+        i++;
+    }
+    i = 0;
+    while (i < k)
+    {
+        pSet -> keys[i] = createKey(vals[i]);
+        int slot = 0;
+        if (findInValueSet(pSet, &(pSet -> keys[i]), &slot) == VALUE_NOT_FOUND)
+        {
+            pSet -> table[slot] = i;
+        }
+        i++;
+    }
+    return true;
+}
+
+
+/*-----=  Unrolled Linked List Functions  =-----*/
+
+
+/**
+ * @brief Creates a new empty Block from the given Node Pool.
+ * @param pPool A pointer to the Node Pool to take the Block from.
+ * @param capacity The number of bytes for values in the Block.
+ * @return A pointer to the new Block, or NULL if the allocation failed.
+ */
+static UnrolledBlock * createBlock(NodePool *pPool, int const capacity)
+{
+    UnrolledBlock *pBlock = (UnrolledBlock *)allocateMemory(pPool,
+                                                            sizeof(UnrolledBlock) + capacity);
+    if (pBlock != NULL)
+    {
+        pBlock -> next = NULL;
+        pBlock -> count = EMPTY_LIST_SIZE;
+        pBlock -> used = NO_ALLOCATE_SIZE;
+        pBlock -> capacity = capacity;
+    }
+    return pBlock;
+}
+
+/**
+ * @brief Returns the given Block to the given Node Pool it was taken from.
+ * @param pPool A pointer to the Node Pool.
+ * @param pBlock A pointer to the Block to free.
+ */
+static void freeBlock(NodePool *pPool, UnrolledBlock *pBlock)
+{
+    deallocateMemory(pPool, pBlock, sizeof(UnrolledBlock) + pBlock -> capacity);
+    return;
+}
+
+/**
+ * @brief Returns the size in bytes of the given Block, including the values in it.
+ * @param pBlock A pointer to the Block.
+ * @return The allocated size for the Block.
+ */
+static int getBlockSize(UnrolledBlock const *pBlock)
+{
+    return sizeof(UnrolledBlock) + pBlock -> capacity;
+}
+
+/**
+ * @brief Checks if the value in the given position of the given Block is equal to the given
+ *        value. The hash values and the lengths are compared before the values themselves.
+ * @param pBlock A pointer to the Block.
+ * @param position The position of the value in the Block.
+ * @param pKey A pointer to the Value Key of the value to compare with.
+ * @return true iff the values are equal.
+ */
+static bool isBlockValueEqual(UnrolledBlock const *pBlock, int const position,
+                              ValueKey const *pKey)
+{
+    STATS_ADD(comparisons, 1);
+    if ((pBlock -> hashes[position] != pKey -> hash) ||
+        ((size_t)pBlock -> lengths[position] != pKey -> length))
+    {
+        return false;
+    }
+    return memcmp(pBlock -> data + pBlock -> offsets[position], pKey -> value,
+                  pKey -> length) == STRING_EQUALITY;
+}
+
+/**
+ * @brief Adds the given value to the beginning of the given unrolled Linked List. The value is
+ *        copied into the first Block, and a new first Block is created only if it is full.
+ * @param l A pointer to the Linked List.
+ * @param pKey A pointer to the Value Key of the value to add.
+ * @return true iff succeed.
+ */
+static bool insertFirstUnrolled(MyLinkedListP l, ValueKey const *pKey)
+{
+    int const size = (int)(sizeof(char) * (pKey -> length + STRING_TERMINATOR_COUNT));
+    UnrolledBlock *pBlock = l -> firstBlock;
+    if ((pBlock == NULL) || (pBlock -> count == BLOCK_CAPACITY) ||
+        (pBlock -> used + size > pBlock -> capacity))
+    {
+        pBlock = createBlock(l -> pool, (size > BLOCK_DATA_SIZE) ? size : BLOCK_DATA_SIZE);
+        if (pBlock == NULL)
+        {
+            return false;
+        }
+        pBlock -> next = l -> firstBlock;
+        l -> firstBlock = pBlock;
+        l -> bytes += getBlockSize(pBlock);
+    }
+
+    memcpy(pBlock -> data + pBlock -> used, pKey -> value, size);
+    pBlock -> hashes[pBlock -> count] = pKey -> hash;
+    pBlock -> lengths[pBlock -> count] = (int)pKey -> length;
+    pBlock -> offsets[pBlock -> count] = pBlock -> used;
+    pBlock -> used += size;
+    (pBlock -> count)++;
+    (l -> size)++;
+    return true;
+}
+
+/**
+ * @brief Removes the first value of the given unrolled Linked List, which is not empty.
+ * @param l A pointer to the Linked List.
+ */
+static void removeUnrolledFirst(MyLinkedListP l)
+{
+    UnrolledBlock *pBlock = l -> firstBlock;
+    assert((pBlock != NULL) && (pBlock -> count > EMPTY_LIST_SIZE));
+    (pBlock -> count)--;
+    pBlock -> used = pBlock -> offsets[pBlock -> count];
+    if (pBlock -> count == EMPTY_LIST_SIZE)
+    {
+        l -> firstBlock = pBlock -> next;
+        l -> bytes -= getBlockSize(pBlock);
+        freeBlock(l -> pool, pBlock);
+    }
+    (l -> size)--;
+    return;
+}
+
+/**
+ * @brief Removes the occurrences of the given value from the given Block. The remaining values
+ *        are moved together, in the arrays and in the data.
+ * @param pBlock A pointer to the Block.
+ * @param pKey A pointer to the Value Key of the value to remove.
+ * @return The number of values that were removed.
+ */
+static int removeBlockData(UnrolledBlock *pBlock, ValueKey const *pKey)
+{
+    int kept = 0;
+    int used = NO_ALLOCATE_SIZE;
+    int i = 0;
+    while (i < pBlock -> count)
+    {
+        if (!isBlockValueEqual(pBlock, i, pKey))
+        {
+            int const size = pBlock -> lengths[i] + STRING_TERMINATOR_COUNT;
+            if (kept != i)
+            {
+                memmove(pBlock -> data + used, pBlock -> data + pBlock -> offsets[i], size);
+                pBlock -> hashes[kept] = pBlock -> hashes[i];
+                pBlock -> lengths[kept] = pBlock -> lengths[i];
+                pBlock -> offsets[kept] = used;
+            }
+            used += size;
+            kept++;
+        }
+        i++;
+    }
+    int const numberOfOccurrences = pBlock -> count - kept;
+    pBlock -> count = kept;
+    pBlock -> used = used;
+    return numberOfOccurrences;
+}
+
+/**
+ * @brief Moves the values of the given Block to the end of the given previous Block, if they fit
+ *        in it.
+ * @param pPrevious A pointer to the previous Block.
+ * @param pBlock A pointer to the Block.
+ * @return true iff the values were moved.
+ */
+static bool mergeBlocks(UnrolledBlock *pPrevious, UnrolledBlock const *pBlock)
+{
+    if ((pPrevious -> count + pBlock -> count > BLOCK_CAPACITY) ||
+        (pPrevious -> used + pBlock -> used > pPrevious -> capacity))
+    {
+        return false;
+    }
+
+    // The values of the Block follow the values of the previous Block, so in the reversed order
+    // of the arrays they are placed before them, and so is their data.
+    memmove(pPrevious -> data + pBlock -> used, pPrevious -> data, pPrevious -> used);
+    memcpy(pPrevious -> data, pBlock -> data, pBlock -> used);
+    memmove(pPrevious -> hashes + pBlock -> count, pPrevious -> hashes,
+            sizeof(unsigned int) * pPrevious -> count);
+    memcpy(pPrevious -> hashes, pBlock -> hashes, sizeof(unsigned int) * pBlock -> count);
+    memmove(pPrevious -> lengths + pBlock -> count, pPrevious -> lengths,
+            sizeof(int) * pPrevious -> count);
+    memcpy(pPrevious -> lengths, pBlock -> lengths, sizeof(int) * pBlock -> count);
+    int i = 0;
+    while (i < pPrevious -> count)
+    {
+        pPrevious -> offsets[pBlock -> count + pPrevious -> count - 1 - i] =
+                pPrevious -> offsets[pPrevious -> count - 1 - i] + pBlock -> used;
+        i++;
+    }
+    memcpy(pPrevious -> offsets, pBlock -> offsets, sizeof(int) * pBlock -> count);
+    pPrevious -> count += pBlock -> count;
+    pPrevious -> used += pBlock -> used;
+    return true;
+}
+
+/**
+ * @brief Removes the values of the given Block which are in the given Value Set, and counts the
+ *        removed occurrences of each of them in the Value Set. The remaining values are moved
+ *        together, in the arrays and in the data.
+ * @param pBlock A pointer to the Block.
+ * @param pSet A pointer to the Value Set of the values to remove.
+ * @return The number of values that were removed.
+ */
+static int removeBlockValues(UnrolledBlock *pBlock, ValueSet *pSet)
+{
+    int kept = 0;
+    int used = NO_ALLOCATE_SIZE;
+    int i = 0;
+    while (i < pBlock -> count)
+    {
+        ValueKey key;
+        key.value = pBlock -> data + pBlock -> offsets[i];
+        key.length = pBlock -> lengths[i];
+        key.hash = pBlock -> hashes[i];
+        int const position = findInValueSet(pSet, &key, NULL);
+        if (position != VALUE_NOT_FOUND)
+        {
+            (pSet -> counts[position])++;
+        }
+        else
+        {
+            int const size = pBlock -> lengths[i] + STRING_TERMINATOR_COUNT;
+            if (kept != i)
+            {
+                memmove(pBlock -> data + used, pBlock -> data + pBlock -> offsets[i], size);
+                pBlock -> hashes[kept] = pBlock -> hashes[i];
+                pBlock -> lengths[kept] = pBlock -> lengths[i];
+                pBlock -> offsets[kept] = used;
+            }
+            used += size;
+            kept++;
+        }
+        i++;
+    }
+    int const numberOfOccurrences = pBlock -> count - kept;
+    pBlock -> count = kept;
+    pBlock -> used = used;
+    return numberOfOccurrences;
+}
+
+/**
+ * @brief Removes the given Block from the given unrolled Linked List if values were removed from
+ *        it and it is empty, or merges it into the previous Block if their values fit in it.
+ * @param l A pointer to the Linked List.
+ * @param previousBlock A pointer to the previous Block, or NULL for the first Block.
+ * @param currentBlock A pointer to the Block.
+ * @return A pointer to the Block which is previous to the next Block.
+ */
+static UnrolledBlock * settleBlock(MyLinkedListP l, UnrolledBlock *previousBlock,
+                                   UnrolledBlock *currentBlock)
+{
+    if ((currentBlock -> count == EMPTY_LIST_SIZE) ||
+        ((previousBlock != NULL) && mergeBlocks(previousBlock, currentBlock)))
+    {
+        if (previousBlock == NULL)
+        {
+            l -> firstBlock = currentBlock -> next;
+        }
+        else
+        {
+            previousBlock -> next = currentBlock -> next;
+        }
+        l -> bytes -= getBlockSize(currentBlock);
+        freeBlock(l -> pool, currentBlock);
+        return previousBlock;
+    }
+    return currentBlock;
+}
+
+/**
+ * @brief Removes the values of the given unrolled Linked List which are in the given Value Set,
+ *        in a single scan which stops after the given number of values were removed.
+ * @param l A pointer to the Linked List.
+ * @param pSet A pointer to the Value Set of the values to remove.
+ * @param maxOccurrences The number of values to remove, or the size of the Linked List if it is
+ *        not known.
+ * @return The number of values that were removed.
+ */
+static int removeUnrolledValues(MyLinkedListP l, ValueSet *pSet, int const maxOccurrences)
+{
+    int numberOfOccurrences = NO_OCCURRENCES;
+    UnrolledBlock *previousBlock = NULL;
+    UnrolledBlock *currentBlock = l -> firstBlock;
+    while ((currentBlock != NULL) && (numberOfOccurrences < maxOccurrences))
+    {
+        numberOfOccurrences += removeBlockValues(currentBlock, pSet);
+        UnrolledBlock *nextBlock = currentBlock -> next;
+        previousBlock = settleBlock(l, previousBlock, currentBlock);
+        currentBlock = nextBlock;
+    }
+    l -> size -= numberOfOccurrences;
+    return numberOfOccurrences;
+}
+
+/**
+ * @brief Removes the occurrences of the given value from the given unrolled Linked List.
+ *        An empty Block is removed, and a Block is merged into the previous one if their values
+ *        fit in the previous Block. The scan stops after the Block of the last occurrence to
+ *        remove.
+ * @param l A pointer to the Linked List.
+ * @param pKey A pointer to the Value Key of the value to remove.
+ * @param maxOccurrences The number of occurrences of the value in the Linked List, or its size
+ *        if it is not known.
+ * @return The number of values that were removed.
+ */
+static int removeUnrolledData(MyLinkedListP l, ValueKey const *pKey, int const maxOccurrences)
+{
+    int numberOfOccurrences = NO_OCCURRENCES;
+    UnrolledBlock *previousBlock = NULL;
+    UnrolledBlock *currentBlock = l -> firstBlock;
+    while ((currentBlock != NULL) && (numberOfOccurrences < maxOccurrences))
+    {
+        numberOfOccurrences += removeBlockData(currentBlock, pKey);
+        UnrolledBlock *nextBlock = currentBlock -> next;
+        previousBlock = settleBlock(l, previousBlock, currentBlock);
+        currentBlock = nextBlock;
+    }
+    l -> size -= numberOfOccurrences;
+    return numberOfOccurrences;
+}
+
+/**
+ * @brief Counts the occurrences of the given value in the given unrolled Linked List.
+ * @param l A pointer to the Linked List.
+ * @param pKey A pointer to the Value Key of the value to count.
+ * @return The number of occurrences of the value.
+ */
+static int countUnrolled(MyLinkedListP const l, ValueKey const *pKey)
+{
+    int numberOfOccurrences = NO_OCCURRENCES;
+    UnrolledBlock const *currentBlock = l -> firstBlock;
+    while (currentBlock != NULL)
+    {
+        int i = 0;
+        while (i < currentBlock -> count)
+        {
+            if (isBlockValueEqual(currentBlock, i, pKey))
+            {
+                numberOfOccurrences++;
+            }
+            i++;
+        }
+        currentBlock = currentBlock -> next;
+    }
+    return numberOfOccurrences;
+}
+
+/**
+ * @brief Helper function for cloneList, which clones the Blocks starting at the given Block to
+ *        the given pointer for the clone unrolled List, in the same order. Each Block is copied
+ *        at once, with its values.
+ * @param pMyLinkedList A pointer for the clone Linked List.
+ * @param pFirstBlock A pointer to the first Block to clone.
+ * @return true iff succeed.
+ */
+static bool cloneUnrolledHelper(MyLinkedListP const pMyLinkedList,
+                                UnrolledBlock const * const pFirstBlock)
+{
+    UnrolledBlock **pTail = &(pMyLinkedList -> firstBlock);
+    UnrolledBlock const *currentBlock = pFirstBlock;
+    while (currentBlock != NULL)
+    {
+        UnrolledBlock *pCopy = createBlock(pMyLinkedList -> pool, currentBlock -> capacity);
+        if (pCopy == NULL)
+        {
+            return false;
+        }
+        memcpy(pCopy, currentBlock, sizeof(UnrolledBlock) + currentBlock -> used);
+        pCopy -> next = NULL;
+        *pTail = pCopy;
+        pTail = &(pCopy -> next);
+        pMyLinkedList -> size += currentBlock -> count;
+        pMyLinkedList -> bytes += getBlockSize(pCopy);
+        currentBlock = currentBlock -> next;
+    }
+    return true;
+}
+
+
+/*-----=  Ordered Linked List Functions  =-----*/
+
+
+/**
+ * @brief Gets the link to the next Node in the given level, of the given Node of an ordered Linked
+ *        List or of its Head. The lowest level is the regular Linked List, so its links are the
+ *        next pointers of the Nodes, and the links in the higher levels of a Node are stored right
+ *        before it, from the lowest of them to the highest.
+ * @param l A pointer to the Linked List.
+ * @param pNode A pointer to the Node, or NULL for the Head.
+ * @param level The level, lower than the height of the Node.
+ * @return A pointer to the link.
+ */
+static Node ** getSkipLink(MyLinkedListP l, Node *pNode, int const level)
+{
+    if (pNode == NULL)
+    {
+        return (level == 0) ? &(l -> head) : &(l -> skipHeads[level]);
+    }
+    return (level == 0) ? &(pNode -> next) : (((Node **)pNode) - level);
+}
+
+/**
+ * @brief Returns the size in bytes of the given Node of an ordered Linked List, with its links.
+ * @param pNode A pointer to the Node.
+ * @return The allocated size for the Node.
+ */
+static int getOrderedNodeSize(Node * const pNode)
+{
+    return getSizeOfNode(pNode) + (int)((pNode -> height - 1) * sizeof(Node *));
+}
+
+/**
+ * @brief Gets a random height for a new Node of the given ordered Linked List, so each level has
+ *        about a quarter of the Nodes of the level below it.
+ * @param l A pointer to the Linked List.
+ * @return The height, between 1 and SKIP_MAX_HEIGHT.
+ */
+static int getRandomHeight(MyLinkedListP l)
+{
+    l -> skipRandom = (l -> skipRandom * SKIP_RANDOM_MULTIPLIER) + SKIP_RANDOM_INCREMENT;
+    unsigned long long bits = l -> skipRandom >> SKIP_RANDOM_SHIFT;
+    int height = 1;
+    while ((height < SKIP_MAX_HEIGHT) && ((bits & SKIP_LEVEL_MASK) == 0))
+    {
+        height++;
+        bits >>= SKIP_LEVEL_BITS;
+    }
+    return height;
+}
+
+/**
+ * @brief Creates a new Node of the given height for the given ordered Linked List, from its Node
+ *        Pool, and initialize it with the given data. All its links are NULL.
+ * @param l A pointer to the Linked List.
+ * @param pKey A pointer to the Value Key of the data to assign for the new Node.
+ * @param height The height of the Node.
+ * @return A pointer to the new Node, or NULL if the allocation failed.
+ */
+static Node * createOrderedNode(MyLinkedListP l, ValueKey const *pKey, int const height)
+{
+    Node **pLinks = (Node **)allocateMemory(l -> pool, ((height - 1) * sizeof(Node *)) +
+                                                       getNodeSize(pKey -> length));
+    if (pLinks == NULL)
+    {
+        return NULL;
+    }
+    Node *pNode = (Node *)(pLinks + (height - 1));
+    initializeNode(pNode, pKey);
+    pNode -> height = (unsigned char)height;
+    int level = 1;
+    while (level < height)
+    {
+        *getSkipLink(l, pNode, level) = NULL;
+        level++;
+    }
+    return pNode;
+}
+
+/**
+ * @brief Frees the given Node of an ordered Linked List, with its links, to the given Node Pool.
+ * @param pPool A pointer to the Node Pool the Node was taken from.
+ * @param pNode A pointer to the Node to free.
+ * @return A pointer to the next Node of the Node we are about to free.
+ */
+static Node * freeOrderedNode(NodePool *pPool, Node *pNode)
+{
+    Node *pNext = pNode -> next;
+    deallocateMemory(pPool, ((Node **)pNode) - (pNode -> height - 1),
+                     ((pNode -> height - 1) * sizeof(Node *)) + getNodeSize(pNode -> length));
+    return pNext;
+}
+
+/**
+ * @brief Compares the data of the given Node with the given value, in the order of strcmp.
+ * @param pNode A pointer to the Node.
+ * @param pKey A pointer to the Value Key of the value.
+ * @return A negative number if the data comes before the value, 0 if they are equal, or a
+ *         positive number if the data comes after the value.
+ */
+static int compareNodeKey(Node const *pNode, ValueKey const *pKey)
+{
+    size_t const length = ((size_t)pNode -> length < pKey -> length) ? (size_t)pNode -> length :
+                                                                         pKey -> length;
+    STATS_ADD(comparisons, 1);
+    // The terminator of the shorter string is compared too, so it comes first.
+    return memcmp(getNodeValue(pNode), pKey -> value, length + STRING_TERMINATOR_COUNT);
+}
+
+/**
+ * @brief Finds the first Node of the given ordered Linked List which does not come before the
+ *        given value, from the highest level down, and the last Node before it in each level.
+ * @param l A pointer to the Linked List.
+ * @param pKey A pointer to the Value Key of the value.
+ * @param predecessors An array of SKIP_MAX_HEIGHT Nodes to store the last Node before the value
+ *        in each level in use, or NULL for the Head.
+ * @return A pointer to the first Node which does not come before the value, or NULL.
+ */
+static Node * findOrderedPredecessors(MyLinkedListP l, ValueKey const *pKey, Node **predecessors)
+{
+    Node *pPrevious = NULL;
+    int level = l -> skipHeight - 1;
+    while (level >= 0)
+    {
+        Node *pNext = *getSkipLink(l, pPrevious, level);
+        while ((pNext != NULL) && (compareNodeKey(pNext, pKey) < STRING_EQUALITY))
+        {
+            pPrevious = pNext;
+            pNext = *getSkipLink(l, pPrevious, level);
+        }
+        predecessors[level] = pPrevious;
+        level--;
+    }
+    return *getSkipLink(l, pPrevious, 0);
+}
+
+/**
+ * @brief Adds the given value to the given ordered Linked List, before the first Node which does
+ *        not come before it.
+ * @param l A pointer to the Linked List.
+ * @param pKey A pointer to the Value Key of the value to add.
+ * @return true iff succeed.
+ */
+static bool insertOrdered(MyLinkedListP l, ValueKey const *pKey)
+{
+    Node *predecessors[SKIP_MAX_HEIGHT];
+    findOrderedPredecessors(l, pKey, predecessors);
+    Node *pNode = createOrderedNode(l, pKey, getRandomHeight(l));
+    if (pNode == NULL)
+    {
+        return false;
+    }
+    while (l -> skipHeight < pNode -> height)
+    {
+        predecessors[l -> skipHeight] = NULL;
+        (l -> skipHeight)++;
+    }
+
+    int level = 0;
+    while (level < pNode -> height)
+    {
+        Node **pLink = getSkipLink(l, predecessors[level], level);
+        *getSkipLink(l, pNode, level) = *pLink;
+        *pLink = pNode;
+        level++;
+    }
+    (l -> size)++;
+    l -> bytes += getOrderedNodeSize(pNode);
+    return true;
+}
+
+/**
+ * @brief Removes the given Node from all the levels of the given ordered Linked List and frees it.
+ * @param l A pointer to the Linked List.
+ * @param predecessors The last Node before the Node in each level of it, or NULL for the Head.
+ * @param pNode A pointer to the Node to remove.
+ */
+static void removeOrderedNode(MyLinkedListP l, Node **predecessors, Node *pNode)
+{
+    int level = 0;
+    while (level < pNode -> height)
+    {
+        *getSkipLink(l, predecessors[level], level) = *getSkipLink(l, pNode, level);
+        level++;
+    }
+    while ((l -> skipHeight > 1) && (l -> skipHeads[l -> skipHeight - 1] == NULL))
+    {
+        (l -> skipHeight)--;
+    }
+    (l -> size)--;
+    l -> bytes -= getOrderedNodeSize(pNode);
+    freeOrderedNode(l -> pool, pNode);
+    return;
+}
+
+/**
+ * @brief Removes the occurrences of the given value from the given ordered Linked List. They are
+ *        all next to each other, so only they are visited after the search.
+ * @param l A pointer to the Linked List.
+ * @param pKey A pointer to the Value Key of the value to remove.
+ * @param maxOccurrences The largest number of occurrences to remove.
+ * @return The number of elements that were removed.
+ */
+static int removeOrderedData(MyLinkedListP l, ValueKey const *pKey, int const maxOccurrences)
+{
+    Node *predecessors[SKIP_MAX_HEIGHT];
+    Node *pNode = findOrderedPredecessors(l, pKey, predecessors);
+    int numberOfOccurrences = NO_OCCURRENCES;
+    while ((pNode != NULL) && (numberOfOccurrences < maxOccurrences) && isNodeEqual(pNode, pKey))
+    {
+        // The predecessors of the removed Node are the predecessors of the Nodes after it.
+        Node *pNext = pNode -> next;
+        removeOrderedNode(l, predecessors, pNode);
+        pNode = pNext;
+        numberOfOccurrences++;
+    }
+    return numberOfOccurrences;
+}
+
+/**
+ * @brief Counts the occurrences of the given value in the given ordered Linked List.
+ * @param l A pointer to the Linked List.
+ * @param pKey A pointer to the Value Key of the value.
+ * @return The number of occurrences of the value.
+ */
+static int countOrdered(MyLinkedListP const l, ValueKey const *pKey)
+{
+    Node *predecessors[SKIP_MAX_HEIGHT];
+    Node const *pNode = findOrderedPredecessors(l, pKey, predecessors);
+    int numberOfOccurrences = NO_OCCURRENCES;
+    while ((pNode != NULL) && isNodeEqual(pNode, pKey))
+    {
+        numberOfOccurrences++;
+        pNode = pNode -> next;
+    }
+    return numberOfOccurrences;
+}
+
+/**
+ * @brief Removes the values of the given ordered Linked List which are equal to the value before
+ *        them, in a single pass which keeps the last Node in each level.
+ * @param l A pointer to the Linked List.
+ * @return The number of elements that were removed.
+ */
+static int uniqueOrderedList(MyLinkedListP l)
+{
+    Node *predecessors[SKIP_MAX_HEIGHT];
+    int level = 0;
+    while (level < SKIP_MAX_HEIGHT)
+    {
+        predecessors[level] = NULL;
+        level++;
+    }
+
+    int numberOfOccurrences = NO_OCCURRENCES;
+    Node *currentNode = l -> head;
+    while (currentNode != NULL)
+    {
+        level = 0;
+        while (level < currentNode -> height)
+        {
+            predecessors[level] = currentNode;
+            level++;
+        }
+        ValueKey const key = getNodeKey(currentNode);
+        while ((currentNode -> next != NULL) && isNodeEqual(currentNode -> next, &key))
+        {
+            if (l -> index != NULL)
+            {
+                removeFromIndex(l -> index, &key, 1);
+            }
+            removeOrderedNode(l, predecessors, currentNode -> next);
+            numberOfOccurrences++;
+        }
+        currentNode = currentNode -> next;
+    }
+    return numberOfOccurrences;
+}
+
+/**
+ * @brief Helper function for cloneList, which copies the Nodes of the given ordered Linked List
+ *        to the given empty ordered Linked List, with the same heights. The values are already in
+ *        order, so each copy is added after the last Node in each of its levels.
+ * @param pMyLinkedList A pointer to the copy.
+ * @param l A pointer to the Linked List to copy.
+ * @return true iff succeed.
+ */
+static bool cloneOrderedHelper(MyLinkedListP const pMyLinkedList, MyLinkedListP const l)
+{
+    Node *tails[SKIP_MAX_HEIGHT];
+    int level = 0;
+    while (level < SKIP_MAX_HEIGHT)
+    {
+        tails[level] = NULL;
+        level++;
+    }
+
+    Node const *currentNode = l -> head;
+    while (currentNode != NULL)
+    {
+        ValueKey const key = getNodeKey(currentNode);
+        Node *pCopy = createOrderedNode(pMyLinkedList, &key, currentNode -> height);
+        if (pCopy == NULL)
+        {
+            return false;
+        }
+        level = 0;
+        while (level < pCopy -> height)
+        {
+            *getSkipLink(pMyLinkedList, tails[level], level) = pCopy;
+            tails[level] = pCopy;
+            level++;
+        }
+        if (pMyLinkedList -> skipHeight < pCopy -> height)
+        {
+            pMyLinkedList -> skipHeight = pCopy -> height;
+        }
+        (pMyLinkedList -> size)++;
+        pMyLinkedList -> bytes += getOrderedNodeSize(pCopy);
+        currentNode = currentNode -> next;
+    }
+    return true;
+}
+
+
+/*-----=  Doubly Linked List Functions  =-----*/
+
+
+/**
+ * @brief Gets the link to the previous Node of the given Node of a doubly linked Linked List,
+ *        which is stored right before the Node.
+ * @param pNode A pointer to the Node.
+ * @return A pointer to the link, which is NULL for the first Node.
+ */
+static Node ** getPreviousLink(Node *pNode)
+{
+    return ((Node **)pNode) - 1;
+}
+
+/**
+ * @brief Sets the previous Node of the given Node if the given Linked List is doubly linked.
+ * @param l A pointer to the Linked List.
+ * @param pNode A pointer to the Node, or NULL.
+ * @param pPrevious A pointer to the previous Node, or NULL if the Node is the first.
+ */
+static void setPreviousNode(MyLinkedListP l, Node *pNode, Node *pPrevious)
+{
+    if ((l -> mode == DOUBLY_LINKED_MODE) && (pNode != NULL))
+    {
+        *getPreviousLink(pNode) = pPrevious;
+    }
+    return;
+}
+
+/**
+ * @brief Creates a new Node for a doubly linked Linked List from the given Node Pool, with a link
+ *        to the previous Node, and initialize it with the given data.
+ * @param pPool A pointer to the Node Pool to take the Node from.
+ * @param pKey A pointer to the Value Key of the data to assign for the new Node.
+ * @return A pointer to the new Node, or NULL if the allocation failed.
+ */
+static Node * createDoublyNode(NodePool *pPool, ValueKey const *pKey)
+{
+    Node **pLink = (Node **)allocateMemory(pPool, sizeof(Node *) + getNodeSize(pKey -> length));
+    if (pLink == NULL)
+    {
+        return NULL;
+    }
+    *pLink = NULL;
+    Node *pNode = (Node *)(pLink + 1);
+    initializeNode(pNode, pKey);
+    return pNode;
+}
+
+/**
+ * @brief Frees the given Node of a doubly linked Linked List, with its link, to the given Node
+ *        Pool.
+ * @param pPool A pointer to the Node Pool the Node was taken from.
+ * @param pNode A pointer to the Node to free.
+ * @return A pointer to the next Node of the Node we are about to free.
+ */
+static Node * freeDoublyNode(NodePool *pPool, Node *pNode)
+{
+    Node *pNext = pNode -> next;
+    deallocateMemory(pPool, getPreviousLink(pNode), sizeof(Node *) + getNodeSize(pNode -> length));
+    return pNext;
+}
+
+/**
+ * @brief Unlinks the given Node from the given doubly linked Linked List, by its previous and
+ *        next Nodes only.
+ * @param l A pointer to the Linked List.
+ * @param pNode A pointer to the Node to unlink.
+ */
+static void unlinkDoublyNode(MyLinkedListP l, Node *pNode)
+{
+    Node *pPrevious = *getPreviousLink(pNode);
+    if (pPrevious == NULL)
+    {
+        l -> head = pNode -> next;
+    }
+    else
+    {
+        pPrevious -> next = pNode -> next;
+    }
+    setPreviousNode(l, pNode -> next, pPrevious);
+    return;
+}
+
+/**
+ * @brief Sets the previous Node of every Node of the given doubly linked Linked List, after its
+ *        Nodes were relinked in another order.
+ * @param l A pointer to the Linked List.
+ */
+static void relinkPreviousNodes(MyLinkedListP l)
+{
+    Node *pPrevious = NULL;
+    Node *currentNode = l -> head;
+    while (currentNode != NULL)
+    {
+        setPreviousNode(l, currentNode, pPrevious);
+        pPrevious = currentNode;
+        currentNode = currentNode -> next;
+    }
+    return;
+}
+
+/**
+ * @brief Helper function for cloneList, which copies the Nodes of the given doubly linked Linked
+ *        List to the given empty doubly linked Linked List, in the same order.
+ * @param pMyLinkedList A pointer to the copy.
+ * @param l A pointer to the Linked List to copy.
+ * @return true iff succeed.
+ */
+static bool cloneDoublyHelper(MyLinkedListP const pMyLinkedList, MyLinkedListP const l)
+{
+    Node *pTail = NULL;
+    Node const *currentNode = l -> head;
+    while (currentNode != NULL)
+    {
+        ValueKey const key = getNodeKey(currentNode);
+        Node *pCopy = createDoublyNode(pMyLinkedList -> pool, &key);
+        if (pCopy == NULL)
+        {
+            return false;
+        }
+        if (pTail == NULL)
+        {
+            pMyLinkedList -> head = pCopy;
+        }
+        else
+        {
+            pTail -> next = pCopy;
+        }
+        setPreviousNode(pMyLinkedList, pCopy, pTail);
+        pTail = pCopy;
+        (pMyLinkedList -> size)++;
+        pMyLinkedList -> bytes += getSizeOfNode(pCopy) + (int)sizeof(Node *);
+        currentNode = currentNode -> next;
+    }
+    return true;
+}
+
+
+/*-----=  Concurrent Linked List Functions  =-----*/
+
+
+/**
+ * The key of the Node Cache of each thread, which frees the Node Cache when the thread exits.
+ */
+static pthread_key_t gNodeCacheKey;
+
+/**
+ * Whether gNodeCacheKey was created, which happens once, by the first thread that needs it.
+ */
+static pthread_once_t gNodeCacheOnce = PTHREAD_ONCE_INIT;
+
+/**
+ * Whether creating gNodeCacheKey succeeded.
+ */
+static bool gNodeCacheCreated = false;
+
+
+/**
+ * @brief Gets the Node Lock which is allocated right before the given Node of a concurrent Linked
+ *        List.
+ * @param pNode A pointer to the Node.
+ * @return A pointer to the Node Lock of the Node.
+ */
+static NodeLock * getNodeLockOf(Node *pNode)
+{
+    return ((NodeLock *)pNode) - 1;
+}
+
+/**
+ * @brief Gets the lock of the given Node of a concurrent Linked List.
+ * @param pNode A pointer to the Node.
+ * @return A pointer to the lock of the Node.
+ */
+static pthread_mutex_t * getNodeLock(Node *pNode)
+{
+    return &(getNodeLockOf(pNode) -> mutex);
+}
+
+/**
+ * @brief Gets the size class of a Node of a concurrent Linked List which holds a string of the
+ *        given length, with its Node Lock.
+ * @param length The length of the string.
+ * @return The size class of the Node, or LARGE_SIZE_CLASS if it is too large to be cached.
+ */
+static int getConcurrentSizeClass(size_t const length)
+{
+    return getSizeClass(sizeof(NodeLock) + getNodeSize(length));
+}
+
+/**
+ * @brief Frees the given Node Cache and all the Nodes in it, when its thread exits.
+ * @param pCache A pointer to the Node Cache.
+ */
+static void freeNodeCache(void *pCache)
+{
+    NodeCache *pNodeCache = (NodeCache *)pCache;
+    int sizeClass;
+    for (sizeClass = 0; sizeClass < NUMBER_OF_SIZE_CLASSES; sizeClass++)
+    {
+        Node *currentNode = pNodeCache -> freeNodes[sizeClass];
+        while (currentNode != NULL)
+        {
+            Node *pNext = getNodeLockOf(currentNode) -> nextRemoved;
+            free(getNodeLockOf(currentNode));
+            currentNode = pNext;
+        }
+    }
+    free(pNodeCache);
+    return;
+}
+
+/**
+ * @brief Creates gNodeCacheKey, for pthread_once.
+ */
+static void createNodeCacheKey()
+{
+    gNodeCacheCreated = (pthread_key_create(&gNodeCacheKey, freeNodeCache) == 0);
+    return;
+}
+
+/**
+ * @brief Gets the Node Cache of the calling thread, and creates it on the first call.
+ *        Only the calling thread uses its Node Cache, so no lock is needed.
+ * @return A pointer to the Node Cache, or NULL if it could not be created.
+ */
+static NodeCache * getNodeCache()
+{
+    pthread_once(&gNodeCacheOnce, createNodeCacheKey);
+    if (!gNodeCacheCreated)
+    {
+        return NULL;
+    }
+    NodeCache *pCache = (NodeCache *)pthread_getspecific(gNodeCacheKey);
+    if (pCache == NULL)
+    {
+        pCache = (NodeCache *)calloc(1, sizeof(NodeCache));
+        if ((pCache != NULL) && (pthread_setspecific(gNodeCacheKey, pCache) != 0))
+        {
+            free(pCache);
+            pCache = NULL;
+        }
+    }
+    return pCache;
+}
+
+/**
+ * @brief Creates a new Node for a concurrent Linked List, with a lock of its own, and initialize
+ *        it with the given data. Such Nodes are not taken from the Node Pool, which is not
+ *        thread safe, but from the Node Cache of the calling thread, so most Nodes take no
+ *        allocation. Otherwise the Node is allocated by itself, as large as its whole size class,
+ *        so it can be cached when it is freed.
+ * @param pKey A pointer to the Value Key of the data to assign for the new Node.
+ * @return A pointer to the new Node, or NULL if the allocation failed.
+ */
+static Node * createConcurrentNode(ValueKey const *pKey)
+{
+    assert((pKey != NULL) && (pKey -> value != NULL));
+
+    int const sizeClass = getConcurrentSizeClass(pKey -> length);
+    NodeCache *pCache = (sizeClass == LARGE_SIZE_CLASS) ? NULL : getNodeCache();
+    NodeLock *pLock = NULL;
+    if ((pCache != NULL) && (pCache -> freeNodes[sizeClass] != NULL))
+    {
+        pLock = getNodeLockOf(pCache -> freeNodes[sizeClass]);
+        pCache -> freeNodes[sizeClass] = pLock -> nextRemoved;
+        (pCache -> numberOfNodes)--;
+    }
+    else
+    {
+        size_t const size = (sizeClass == LARGE_SIZE_CLASS) ?
+                            sizeof(NodeLock) + getNodeSize(pKey -> length) :
+                            getPooledSize(sizeof(NodeLock) + getNodeSize(pKey -> length));
+        pLock = (NodeLock *)malloc(size);
+        if (pLock == NULL)
+        {
+            return NULL;
+        }
+    }
+    if (pthread_mutex_init(&(pLock -> mutex), NULL) != 0)
+    {
+        free(pLock);
+        return NULL;
+    }
+    pLock -> removed = false;
+    pLock -> nextRemoved = NULL;
+    Node *pNode = (Node *)(pLock + 1);
+    initializeNode(pNode, pKey);
+    return pNode;
+}
+
+/**
+ * @brief Destroys the lock of the given Node of a concurrent Linked List, and returns its memory to
+ *        the Node Cache of the calling thread, or frees it if the Node Cache is full. The lock
+ *        must not be held.
+ * @param pNode A pointer to the Node to free.
+ * @return A pointer to the next Node of the Node we are about to free.
+ */
+static Node * freeConcurrentNode(Node *pNode)
+{
+    Node *pNext = pNode -> next;
+    pthread_mutex_destroy(getNodeLock(pNode));
+    int const sizeClass = getConcurrentSizeClass(pNode -> length);
+    NodeCache *pCache = (sizeClass == LARGE_SIZE_CLASS) ? NULL : getNodeCache();
+    if ((pCache != NULL) && (pCache -> numberOfNodes < MAX_CACHED_NODES))
+    {
+        getNodeLockOf(pNode) -> nextRemoved = pCache -> freeNodes[sizeClass];
+        pCache -> freeNodes[sizeClass] = pNode;
+        (pCache -> numberOfNodes)++;
+    }
+    else
+    {
+        free(getNodeLockOf(pNode));
+    }
+    return pNext;
+}
+
+/**
+ * @brief Returns the size in bytes of the given Node of the given Linked List, with its lock in
+ *        CONCURRENT_MODE or with its links in ORDERED_MODE and DOUBLY_LINKED_MODE.
+ * @param l A pointer to the Linked List.
+ * @param pNode A pointer to the Node.
+ * @return The allocated size for the Node.
+ */
+static int getListNodeSize(MyLinkedListP const l, Node * const pNode)
+{
+    int sizeOf = getSizeOfNode(pNode);
+    if (l -> mode == CONCURRENT_MODE)
+    {
+        sizeOf += sizeof(NodeLock);
+    }
+    else if (l -> mode == ORDERED_MODE)
+    {
+        sizeOf = getOrderedNodeSize(pNode);
+    }
+    else if (l -> mode == DOUBLY_LINKED_MODE)
+    {
+        sizeOf += sizeof(Node *);
+    }
+    return sizeOf;
+}
+
+/**
+ * @brief Frees the given Node of the given Linked List, either to its Node Pool, with its links
+ *        in ORDERED_MODE and DOUBLY_LINKED_MODE, or with its lock in CONCURRENT_MODE.
+ * @param l A pointer to the Linked List.
+ * @param pNode A pointer to the Node to free.
+ * @return A pointer to the next Node of the Node we are about to free.
+ */
+static Node * releaseNode(MyLinkedListP l, Node *pNode)
+{
+    if (l -> mode == CONCURRENT_MODE)
+    {
+        return freeConcurrentNode(pNode);
+    }
+    if (l -> mode == ORDERED_MODE)
+    {
+        return freeOrderedNode(l -> pool, pNode);
+    }
+    if (l -> mode == DOUBLY_LINKED_MODE)
+    {
+        return freeDoublyNode(l -> pool, pNode);
+    }
+    return freeNode(l -> pool, pNode);
+}
+
+/**
+ * @brief Gets the next Node of the given Node of a concurrent Linked List, which may be relinked
+ *        by another thread at the same time.
+ * @param pLink A pointer to the link to the next Node, either the Head or the next of a Node.
+ * @return A pointer to the next Node.
+ */
+static Node * loadConcurrentLink(Node * const *pLink)
+{
+    return __atomic_load_n(pLink, __ATOMIC_ACQUIRE);
+}
+
+/**
+ * @brief Relinks the given link of a concurrent Linked List, so a thread that follows it without
+ *        any lock sees either the old Node or the new one, which is fully initialized.
+ * @param pLink A pointer to the link, either the Head or the next of a Node.
+ * @param pNode A pointer to the Node to link.
+ */
+static void storeConcurrentLink(Node **pLink, Node *pNode)
+{
+    __atomic_store_n(pLink, pNode, __ATOMIC_RELEASE);
+    return;
+}
+
+/**
+ * @brief Begins a scan of the given concurrent Linked List, which takes no lock. The scan is
+ *        counted in the current phase, so no Node it may reach is freed until it ends.
+ * @param l A pointer to the Linked List.
+ * @return The phase the scan is counted in, to pass to endConcurrentScan.
+ */
+static int beginConcurrentScan(MyLinkedListP l)
+{
+    int const phase = __atomic_load_n(&(l -> readPhase), __ATOMIC_RELAXED);
+    __atomic_add_fetch(&(l -> readers[phase]), 1, __ATOMIC_SEQ_CST);
+    // Pairs with the fence of waitForConcurrentScans: either the removal sees this scan, or this
+    // scan sees the Nodes already unlinked.
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    return phase;
+}
+
+/**
+ * @brief Ends a scan of the given concurrent Linked List which began with beginConcurrentScan.
+ * @param l A pointer to the Linked List.
+ * @param phase The phase the scan is counted in.
+ */
+static void endConcurrentScan(MyLinkedListP l, int const phase)
+{
+    __atomic_sub_fetch(&(l -> readers[phase]), 1, __ATOMIC_RELEASE);
+    return;
+}
+
+/**
+ * @brief Waits until all the scans of the given concurrent Linked List which began before the
+ *        call have ended, so the Nodes unlinked before the call can be freed.
+ *        Each phase is closed in turn and waited for, so a scan that read the phase just before
+ *        it changed is waited for as well. New scans are never blocked.
+ * @param l A pointer to the Linked List.
+ */
+static void waitForConcurrentScans(MyLinkedListP l)
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    pthread_mutex_lock(&(l -> phaseLock));
+    int i;
+    for (i = 0; i < READ_PHASES; i++)
+    {
+        int const phase = l -> readPhase;
+        __atomic_store_n(&(l -> readPhase), (phase + 1) % READ_PHASES, __ATOMIC_SEQ_CST);
+        while (__atomic_load_n(&(l -> readers[phase]), __ATOMIC_ACQUIRE) != 0)
+        {
+            sched_yield();
+        }
+    }
+    pthread_mutex_unlock(&(l -> phaseLock));
+    return;
+}
+
+/**
+ * @brief Links the given chain of new Nodes to the beginning of the given concurrent Linked List,
+ *        without any lock. The Head is swapped by compare and swap, which is retried if another
+ *        thread changed it first. A Head which was freed and allocated again in the meantime
+ *        does no harm, since the chain is then linked to the same Node it points to.
+ * @param l A pointer to the Linked List.
+ * @param pFirst A pointer to the first Node of the chain.
+ * @param pLast A pointer to the last Node of the chain.
+ * @param numberOfNodes The number of Nodes in the chain.
+ * @param numberOfBytes The number of bytes of the Nodes in the chain.
+ */
+static void linkConcurrentNodes(MyLinkedListP l, Node *pFirst, Node *pLast,
+                                int const numberOfNodes, int const numberOfBytes)
+{
+    Node *oldHead = loadConcurrentLink(&(l -> head));
+    do
+    {
+        pLast -> next = oldHead;
+    } while (!__atomic_compare_exchange_n(&(l -> head), &oldHead, pFirst, true,
+                                          __ATOMIC_RELEASE, __ATOMIC_ACQUIRE));
+    __atomic_add_fetch(&(l -> size), numberOfNodes, __ATOMIC_RELAXED);
+    STATS_MAX(peakSize, __atomic_load_n(&(l -> size), __ATOMIC_RELAXED));
+    __atomic_add_fetch(&(l -> bytes), numberOfBytes, __ATOMIC_RELAXED);
+    return;
+}
+
+/**
+ * @brief Adds the given value to the beginning of the given concurrent Linked List, with a single
+ *        compare and swap of the Head.
+ * @param l A pointer to the Linked List.
+ * @param pKey A pointer to the Value Key of the value to add.
+ * @return true iff succeed.
+ */
+static bool insertFirstConcurrent(MyLinkedListP l, ValueKey const *pKey)
+{
+    Node *newHead = createConcurrentNode(pKey);
+    if (newHead == NULL)
+    {
+        return false;
+    }
+    linkConcurrentNodes(l, newHead, newHead, 1, getListNodeSize(l, newHead));
+    return true;
+}
+
+/**
+ * @brief Adds the given values to the beginning of the given concurrent Linked List, so the last
+ *        value becomes the first. All the Nodes are created and chained first, and the chain is
+ *        linked with a single compare and swap of the Head, so other threads see either none of
+ *        the values or all of them, and a failed allocation frees only the new Nodes.
+ * @param l A pointer to the Linked List.
+ * @param vals The values to add, none of which is NULL.
+ * @param k The number of values, at least one.
+ * @return true iff succeed.
+ */
+static bool insertManyConcurrent(MyLinkedListP l, char const * const *vals, int const k)
+{
+    Node *pFirst = NULL;
+    Node *pLast = NULL;
+    int numberOfBytes = NO_ALLOCATE_SIZE;
+    int i;
+    for (i = 0; i < k; i++)
+    {
+        ValueKey const key = createKey(vals[i]);
+        Node *pNode = createConcurrentNode(&key);
+        if (pNode == NULL)
+        {
+            while (pFirst != NULL)
+            {
+                pFirst = freeConcurrentNode(pFirst);
+            }
+            return false;
+        }
+        pNode -> next = pFirst;
+        pFirst = pNode;
+        if (pLast == NULL)
+        {
+            pLast = pNode;
+        }
+        numberOfBytes += getListNodeSize(l, pNode);
+    }
+    linkConcurrentNodes(l, pFirst, pLast, k, numberOfBytes);
+    return true;
+}
+
+/**
+ * @brief Unlinks the given Node of a concurrent Linked List from its previous Node, if it is still
+ *        linked right after it. Only the locks of these two Nodes are held, and only while the
+ *        Node is unlinked. Its next is kept, since scans without locks may still be on it.
+ *        The Head is also changed by inserts without any lock, so a Node which is the Head is
+ *        unlinked by compare and swap, which fails if a Node was inserted before it.
+ * @param l A pointer to the Linked List.
+ * @param previousNode A pointer to the previous Node, or NULL if the Node is the Head.
+ * @param pNode A pointer to the Node to unlink.
+ * @return true iff the Node was unlinked.
+ */
+static bool unlinkConcurrentNode(MyLinkedListP l, Node *previousNode, Node *pNode)
+{
+    bool linked = false;
+    if (previousNode == NULL)
+    {
+        pthread_mutex_lock(getNodeLock(pNode));
+        Node *expectedHead = pNode;
+        linked = !(getNodeLockOf(pNode) -> removed) &&
+                 __atomic_compare_exchange_n(&(l -> head), &expectedHead, pNode -> next, false,
+                                             __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+        if (linked)
+        {
+            getNodeLockOf(pNode) -> removed = true;
+        }
+        pthread_mutex_unlock(getNodeLock(pNode));
+        return linked;
+    }
+
+    pthread_mutex_lock(getNodeLock(previousNode));
+    pthread_mutex_lock(getNodeLock(pNode));
+    // A removed Node keeps its next, so the previous Node must be in the list as well.
+    linked = !(getNodeLockOf(previousNode) -> removed) && !(getNodeLockOf(pNode) -> removed) &&
+             (previousNode -> next == pNode);
+    if (linked)
+    {
+        getNodeLockOf(pNode) -> removed = true;
+        storeConcurrentLink(&(previousNode -> next), pNode -> next);
+    }
+    pthread_mutex_unlock(getNodeLock(pNode));
+    pthread_mutex_unlock(getNodeLock(previousNode));
+    return linked;
+}
+
+/**
+ * @brief Removes all the occurrences of the given value from the given concurrent Linked List.
+ *        The Nodes are found by a scan without locks, and each of them is unlinked with the locks
+ *        of only itself and its previous Node. If another thread changed them first, the scan
+ *        starts over. The removed Nodes are freed once all the scans that may be on them ended.
+ * @param l A pointer to the Linked List.
+ * @param pKey A pointer to the Value Key of the value to remove.
+ * @return The number of elements that were removed.
+ */
+static int removeConcurrentData(MyLinkedListP l, ValueKey const *pKey)
+{
+    int numberOfOccurrences = NO_OCCURRENCES;
+    int removedBytes = NO_ALLOCATE_SIZE;
+    Node *removedNodes = NULL;
+
+    int const phase = beginConcurrentScan(l);
+    Node *previousNode = NULL;
+    Node *currentNode = loadConcurrentLink(&(l -> head));
+    while (currentNode != NULL)
+    {
+        if (!isNodeEqual(currentNode, pKey))
+        {
+            previousNode = currentNode;
+            currentNode = loadConcurrentLink(&(currentNode -> next));
+        }
+        else if (unlinkConcurrentNode(l, previousNode, currentNode))
+        {
+            removedBytes += getListNodeSize(l, currentNode);
+            getNodeLockOf(currentNode) -> nextRemoved = removedNodes;
+            removedNodes = currentNode;
+            numberOfOccurrences++;
+            currentNode = loadConcurrentLink((previousNode == NULL) ? &(l -> head) :
+                                             &(previousNode -> next));
+        }
+        else
+        {
+            previousNode = NULL;
+            currentNode = loadConcurrentLink(&(l -> head));
+        }
+    }
+    endConcurrentScan(l, phase);
+
+    if (removedNodes != NULL)
+    {
+        waitForConcurrentScans(l);
+    }
+    while (removedNodes != NULL)
+    {
+        currentNode = removedNodes;
+        removedNodes = getNodeLockOf(currentNode) -> nextRemoved;
+        freeConcurrentNode(currentNode);
+    }
+
+    __atomic_sub_fetch(&(l -> size), numberOfOccurrences, __ATOMIC_RELAXED);
+    __atomic_sub_fetch(&(l -> bytes), removedBytes, __ATOMIC_RELAXED);
+    return numberOfOccurrences;
+}
+
+/**
+ * @brief Calls the given function for each Node of the given concurrent Linked List, in order,
+ *        without taking any lock. Each link is read once, so a Node inserted or removed during
+ *        the scan may or may not be visited, and a removed Node is not freed before it ends.
+ * @param l A pointer to the Linked List.
+ * @param visit The function to call with each Node, which returns false to stop the scan.
+ * @param pContext A pointer to pass to the function.
+ * @return true iff all the Nodes were visited.
+ */
+static bool visitConcurrent(MyLinkedListP const l, bool (*visit)(Node const *, void *),
+                            void *pContext)
+{
+    bool success = true;
+    int const phase = beginConcurrentScan(l);
+    Node *currentNode = loadConcurrentLink(&(l -> head));
+    while (success && (currentNode != NULL))
+    {
+        success = visit(currentNode, pContext);
+        currentNode = loadConcurrentLink(&(currentNode -> next));
+    }
+    endConcurrentScan(l, phase);
+    return success;
+}
+
+/**
+ * A structure for the context of the functions which count a value, the value and its counter.
+ */
+typedef struct ValueCount
+{
+    ValueKey const *pKey;
+    int numberOfOccurrences;
+} ValueCount;
+
+/**
+ * @brief Counts the given Node in the given counter if it holds the value to count.
+ * @param pNode A pointer to the Node.
+ * @param pContext A pointer to the ValueCount.
+ * @return true, to continue the scan.
+ */
+static bool countConcurrentNode(Node const *pNode, void *pContext)
+{
+    ValueCount *pCount = (ValueCount *)pContext;
+    if (isNodeEqual(pNode, pCount -> pKey))
+    {
+        (pCount -> numberOfOccurrences)++;
+    }
+    return true;
+}
+
+/**
+ * @brief Copies the given Node to the end of the concurrent Linked List whose tail link is given.
+ * @param pNode A pointer to the Node to copy.
+ * @param pContext A pointer to the pointer of the tail link of the clone.
+ * @return true iff succeed.
+ */
+static bool cloneConcurrentNode(Node const *pNode, void *pContext)
+{
+    Node ***ppTail = (Node ***)pContext;
+    ValueKey const key = getNodeKey(pNode);
+    Node *pCopy = createConcurrentNode(&key);
+    if (pCopy == NULL)
+    {
+        return false;
+    }
+    **ppTail = pCopy;
+    *ppTail = &(pCopy -> next);
+    return true;
+}
+
+/**
+ * @brief Helper function for cloneList, which clones the given concurrent Linked List to the
+ *        given empty concurrent Linked List, in the same order.
+ * @param pMyLinkedList A pointer to the clone.
+ * @param l A pointer to the Linked List to clone.
+ * @return true iff succeed.
+ */
+static bool cloneConcurrentHelper(MyLinkedListP const pMyLinkedList, MyLinkedListP const l)
+{
+    Node **pTail = &(pMyLinkedList -> head);
+    bool const success = visitConcurrent(l, cloneConcurrentNode, &pTail);
+    Node *currentNode = pMyLinkedList -> head;
+    while (currentNode != NULL)
+    {
+        (pMyLinkedList -> size)++;
+        pMyLinkedList -> bytes += getListNodeSize(pMyLinkedList, currentNode);
+        currentNode = currentNode -> next;
+    }
+    return success;
+}
+
+
+/*-----=  Shared Node Functions  =-----*/
+
+
+/**
+ * @brief Matches the data of the given Node with a single value, for removeLinkedNodes.
+ * @param pNode A pointer to the Node.
+ * @param pContext A pointer to the Value Key of the value.
+ * @return 0 if the data is equal to the value, VALUE_NOT_FOUND otherwise.
+ */
+static int matchNodeKey(Node const *pNode, void *pContext)
+{
+    return isNodeEqual(pNode, (ValueKey const *)pContext) ? 0 : VALUE_NOT_FOUND;
+}
+
+/**
+ * @brief Matches the data of the given interned Node with a single interned value, by comparing
+ *        the pointers only, for removeLinkedNodes.
+ * @param pNode A pointer to the Node.
+ * @param pContext The interned value.
+ * @return 0 if the data is the value, VALUE_NOT_FOUND otherwise.
+ */
+static int matchInternedNode(Node const *pNode, void *pContext)
+{
+    STATS_ADD(comparisons, 1);
+    return (getNodeValue(pNode) == (char const *)pContext) ? 0 : VALUE_NOT_FOUND;
+}
+
+/**
+ * @brief Matches the data of the given Node with the values of a Value Set, for removeLinkedNodes.
+ * @param pNode A pointer to the Node.
+ * @param pContext A pointer to the Value Set.
+ * @return The position of the data in the Value Set, or VALUE_NOT_FOUND.
+ */
+static int matchNodeInSet(Node const *pNode, void *pContext)
+{
+    ValueKey const key = getNodeKey(pNode);
+    return findInValueSet((ValueSet const *)pContext, &key, NULL);
+}
+
+/**
+ * @brief Copies the shared Nodes from the given first Node to the given last Node, without the
+ *        Nodes which match, and counts the matches.
+ * @param l A pointer to the Linked List to take the copies from its Node Pool.
+ * @param pFirst A pointer to the first Node to copy.
+ * @param pLast A pointer to the last Node to copy.
+ * @param match The function which matches a Node, as in removeLinkedNodes.
+ * @param pContext A pointer to pass to the function.
+ * @param counts The counters of the matches of each position, or NULL.
+ * @param ppCopy A pointer to store the first copy, which is linked to the Node after the last Node.
+ * @return The number of Nodes that matched, or MYLIST_ERROR_CODE if the allocation failed.
+ */
+static int copySharedNodes(MyLinkedListP l, Node *pFirst, Node const *pLast,
+                           int (*match)(Node const *, void *), void *pContext, int *counts,
+                           Node **ppCopy)
+{
+    int numberOfOccurrences = NO_OCCURRENCES;
+    int removedBytes = NO_ALLOCATE_SIZE;
+    Node **pTail = ppCopy;
+    Node *currentNode = pFirst;
+    while (currentNode != pLast -> next)
+    {
+        int const position = match(currentNode, pContext);
+        if (position != VALUE_NOT_FOUND)
+        {
+            if (counts != NULL)
+            {
+                (counts[position])++;
+            }
+            removedBytes += getSizeOfNode(currentNode);
+            numberOfOccurrences++;
+        }
+        else
+        {
+            ValueKey const key = getNodeKey(currentNode);
+            Node *pCopy = createNode(l -> pool, &key);
+            if (pCopy == NULL)
+            {
+                *pTail = NULL;
+                Node *pFree = *ppCopy;
+                while (pFree != NULL)
+                {
+                    pFree = freeNode(l -> pool, pFree);
+                }
+                return MYLIST_ERROR_CODE;
+            }
+            *pTail = pCopy;
+            pTail = &(pCopy -> next);
+        }
+        currentNode = currentNode -> next;
+    }
+    *pTail = pLast -> next;
+    if (pLast -> next != NULL)
+    {
+        (pLast -> next -> references)++;
+    }
+    l -> bytes -= removedBytes;
+    return numberOfOccurrences;
+}
+
+/**
+ * @brief Removes the Nodes of the given Linked List which match, stopping after the given number
+ *        of them. The Nodes before the first shared Node are removed in place. If a Node to remove
+ *        is shared, the part from the first shared Node up to the last Node to remove is copied
+ *        instead and linked to the rest of the shared Nodes, which stay as they are.
+ * @param l A pointer to the Linked List to remove from.
+ * @param match The function which matches a Node, which returns the position to count the Node
+ *        in, or VALUE_NOT_FOUND if the Node is not removed.
+ * @param pContext A pointer to pass to the function.
+ * @param counts The counters of the removed Nodes of each position, or NULL.
+ * @param maxOccurrences The number of Nodes to remove, or the size of the Linked List if it is not
+ *        known.
+ * @return The number of elements that were removed, or MYLIST_ERROR_CODE if the allocation of the
+ *         copies failed, in which case the Linked List is not changed.
+ */
+static int removeLinkedNodes(MyLinkedListP l, int (*match)(Node const *, void *), void *pContext,
+                             int *counts, int const maxOccurrences)
+{
+    Node *pShared = NULL;
+    Node *pEnd = NULL;
+    Node *pCopy = NULL;
+    int numberOfSharedOccurrences = NO_OCCURRENCES;
+
+    // Only a Node Pool which is used by clones may hold shared Nodes.
+    if (l -> pool -> references > 1)
+    {
+        Node *pLastMatch = NULL;
+        bool isLastMatchShared = false;
+        int numberOfMatches = NO_OCCURRENCES;
+        Node *currentNode = l -> head;
+        while ((currentNode != NULL) && (numberOfMatches < maxOccurrences))
+        {
+            if ((pShared == NULL) && (currentNode -> references > 1))
+            {
+                pShared = currentNode;
+            }
+            if (match(currentNode, pContext) != VALUE_NOT_FOUND)
+            {
+                pLastMatch = currentNode;
+                isLastMatchShared = (pShared != NULL);
+                numberOfMatches++;
+            }
+            currentNode = currentNode -> next;
+        }
+        if (pLastMatch == NULL)
+        {
+            return NO_OCCURRENCES;
+        }
+        if (isLastMatchShared)
+        {
+            numberOfSharedOccurrences = copySharedNodes(l, pShared, pLastMatch, match, pContext,
+                                                        counts, &pCopy);
+            if (numberOfSharedOccurrences == MYLIST_ERROR_CODE)
+            {
+                return MYLIST_ERROR_CODE;
+            }
+            pEnd = pShared;
+        }
+        else
+        {
+            pShared = NULL;
+            pEnd = pLastMatch -> next;
+        }
+    }
+
+    int numberOfOccurrences = NO_OCCURRENCES;
+    Node *pPrevious = NULL;
+    Node **pLink = &(l -> head);
+    while ((*pLink != pEnd) && (numberOfOccurrences < maxOccurrences))
+    {
+        Node *currentNode = *pLink;
+        int const position = match(currentNode, pContext);
+        if (position != VALUE_NOT_FOUND)
+        {
+            if (counts != NULL)
+            {
+                (counts[position])++;
+            }
+            l -> bytes -= getListNodeSize(l, currentNode);
+            *pLink = releaseNode(l, currentNode);  // The reference to the next Node is moved.
+            setPreviousNode(l, *pLink, pPrevious);
+            numberOfOccurrences++;
+        }
+        else
+        {
+            pPrevious = currentNode;
+            pLink = &(currentNode -> next);
+        }
+    }
+    if (pShared != NULL)
+    {
+        *pLink = pCopy;
+        (pShared -> references)--;
+        numberOfOccurrences += numberOfSharedOccurrences;
+    }
+    l -> size -= numberOfOccurrences;
+    return numberOfOccurrences;
+}
+
+/**
+ * @brief Does not match any Node, so copySharedNodes copies all the Nodes.
+ * @param pNode A pointer to the Node.
+ * @param pContext Not used.
+ * @return VALUE_NOT_FOUND.
+ */
+static int matchNoNode(Node const *pNode, void *pContext)
+{
+    (void)pNode;
+    (void)pContext;
+    return VALUE_NOT_FOUND;
+}
+
+/**
+ * @brief Copies the Nodes of the given Linked List from its first shared Node to its end, so all
+ *        its Nodes can be changed in place. Nodes which are not shared are not copied.
+ * @param l A pointer to the Linked List.
+ * @return true iff succeed. If the allocation failed, the Linked List is not changed.
+ */
+static bool unshareNodes(MyLinkedListP l)
+{
+    if (l -> pool -> references == 1)
+    {
+        return true;
+    }
+    Node **pLink = &(l -> head);
+    while ((*pLink != NULL) && ((*pLink) -> references == 1))
+    {
+        pLink = &((*pLink) -> next);
+    }
+    if (*pLink == NULL)
+    {
+        return true;
+    }
+
+    Node *pShared = *pLink;
+    Node *pLast = pShared;
+    while (pLast -> next != NULL)
+    {
+        pLast = pLast -> next;
+    }
+    Node *pCopy = NULL;
+    if (copySharedNodes(l, pShared, pLast, matchNoNode, NULL, NULL, &pCopy) == MYLIST_ERROR_CODE)
+    {
+        return false;
+    }
+    *pLink = pCopy;
+    (pShared -> references)--;
+    return true;
+}
+
+
+/*-----=  Merge Sort Functions  =-----*/
+
+
+/**
+ * @brief Merges the given sorted runs of Nodes into a single sorted run.
+ *        Of two equal values, the value of the left run comes first, so the merge is stable.
+ * @param pLeft A pointer to the first Node of the left run, or NULL.
+ * @param pRight A pointer to the first Node of the right run, or NULL.
+ * @param cmp The function which compares two values.
+ * @return A pointer to the first Node of the merged run.
+ */
+static Node * mergeRuns(Node *pLeft, Node *pRight, int (*cmp)(char const *, char const *))
+{
+    Node *pMerged = NULL;
+    Node **pTail = &pMerged;
+    while ((pLeft != NULL) && (pRight != NULL))
+    {
+        STATS_ADD(comparisons, 1);
+        if (cmp(getNodeValue(pLeft), getNodeValue(pRight)) <= STRING_EQUALITY)
+        {
+            *pTail = pLeft;
+            pLeft = pLeft -> next;
+        }
+        else
+        {
+            *pTail = pRight;
+            pRight = pRight -> next;
+        }
+        pTail = &((*pTail) -> next);
+    }
+    *pTail = (pLeft != NULL) ? pLeft : pRight;
+    return pMerged;
+}
+
+
+/*-----=  List File Functions  =-----*/
+
+
+/**
+ * @brief Gets the number of bytes of a value of the given length in a saved Linked List file.
+ * @param length The length of the value.
+ * @return The number of bytes of the value.
+ */
+static size_t getEntrySize(int const length)
+{
+    size_t const size = sizeof(ListFileEntry) + length + STRING_TERMINATOR_COUNT;
+    return (size + LIST_FILE_ALIGNMENT - 1) & ~(size_t)(LIST_FILE_ALIGNMENT - 1);
+}
+
+/**
+ * @brief Gets the first value in the given mapping of a saved Linked List file.
+ * @param mapping The mapping.
+ * @return A pointer to the first value.
+ */
+static ListFileEntry const * getFirstEntry(char const *mapping)
+{
+    return (ListFileEntry const *)(mapping + sizeof(ListFileHeader));
+}
+
+/**
+ * @brief Gets the value after the given value in a saved Linked List file.
+ * @param pEntry A pointer to the value.
+ * @return A pointer to the next value.
+ */
+static ListFileEntry const * getNextEntry(ListFileEntry const *pEntry)
+{
+    return (ListFileEntry const *)((char const *)pEntry + getEntrySize(pEntry -> length));
+}
+
+/**
+ * @brief Checks that the given mapping holds a whole saved Linked List file: a header with the
+ *        LIST_FILE_MAGIC bytes and the number of values, and exactly that number of values, each
+ *        with its terminator.
+ * @param mapping The mapping.
+ * @param size The number of bytes in the mapping.
+ * @return The number of values, or MYLIST_ERROR_CODE if the file is not valid.
+ */
+static int checkListFile(char const *mapping, size_t const size)
+{
+    ListFileHeader const *pHeader = (ListFileHeader const *)mapping;
+    if ((size < sizeof(ListFileHeader)) ||
+        (memcmp(pHeader -> magic, LIST_FILE_MAGIC, LIST_FILE_MAGIC_SIZE) != STRING_EQUALITY) ||
+        (pHeader -> count < EMPTY_LIST_SIZE))
+    {
+        return MYLIST_ERROR_CODE;
+    }
+
+    size_t remaining = size - sizeof(ListFileHeader);
+    ListFileEntry const *pEntry = getFirstEntry(mapping);
+    int i = 0;
+    while (i < pHeader -> count)
+    {
+        if ((remaining < sizeof(ListFileEntry)) || (pEntry -> length < 0) ||
+            (getEntrySize(pEntry -> length) > remaining) ||
+            (pEntry -> data[pEntry -> length] != '\0'))
+        {
+            return MYLIST_ERROR_CODE;
+        }
+        remaining -= getEntrySize(pEntry -> length);
+        pEntry = getNextEntry(pEntry);
+        i++;
+    }
+    return (remaining == NO_ALLOCATE_SIZE) ? pHeader -> count : MYLIST_ERROR_CODE;
+}
+
+
+/*-----=  Value Traversal Functions  =-----*/
+
+
+/**
+ * @brief Calls the given function with the Value Key of each value of the given Linked List, in
+ *        order, in every mode. It does not take the locks of a concurrent Linked List.
+ * @param l A pointer to the Linked List.
+ * @param visit The function to call with each value, which returns false to stop the traversal.
+ * @param pContext A pointer to pass to the function.
+ * @return true iff all the values were visited.
+ */
+static bool visitValues(MyLinkedListP const l, bool (*visit)(ValueKey const *, void *),
+                        void *pContext)
+{
+    ValueKey key;
+    UnrolledBlock const *currentBlock = l -> firstBlock;
+    while (currentBlock != NULL)
+    {
+        int i = currentBlock -> count - 1;
+        while (i >= 0)
+        {
+            key.value = currentBlock -> data + currentBlock -> offsets[i];
+            key.length = currentBlock -> lengths[i];
+            key.hash = currentBlock -> hashes[i];
+            if (!visit(&key, pContext))
+            {
+                return false;
+            }
+            i--;
+        }
+        currentBlock = currentBlock -> next;
+    }
+
+    Node const *currentNode = l -> head;
+    while (currentNode != NULL)
+    {
+        key = getNodeKey(currentNode);
+        if (!visit(&key, pContext))
+        {
+            return false;
+        }
+        currentNode = currentNode -> next;
+    }
+
+    if (l -> mode == MAPPED_MODE)
+    {
+        ListFileEntry const *pEntry = getFirstEntry(l -> mapping);
+        int i = 0;
+        while (i < l -> size)
+        {
+            key.value = pEntry -> data;
+            key.length = pEntry -> length;
+            key.hash = pEntry -> hash;
+            if (!visit(&key, pContext))
+            {
+                return false;
+            }
+            pEntry = getNextEntry(pEntry);
+            i++;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Counts the given value in the given counter if it is the value to count.
+ * @param pKey A pointer to the Value Key of the value.
+ * @param pContext A pointer to the ValueCount.
+ * @return true, to continue the traversal.
+ */
+static bool countValue(ValueKey const *pKey, void *pContext)
+{
+    ValueCount *pCount = (ValueCount *)pContext;
+    if (isKeyEqual(pKey, pCount -> pKey))
+    {
+        (pCount -> numberOfOccurrences)++;
+    }
+    return true;
+}
+
+/**
+ * @brief Adds the given value to the given Index.
+ * @param pKey A pointer to the Value Key of the value.
+ * @param pContext A pointer to the Index.
+ * @return true iff succeed.
+ */
+static bool addValueToIndex(ValueKey const *pKey, void *pContext)
+{
+    return addToIndex((ListIndex *)pContext, pKey);
+}
+
+/**
+ * @brief Adds the number of bytes a pooled Node of the given value takes to the given counter.
+ * @param pKey A pointer to the Value Key of the value.
+ * @param pContext A pointer to the counter, a size_t.
+ * @return true, to continue the traversal.
+ */
+static bool addPooledSize(ValueKey const *pKey, void *pContext)
+{
+    *((size_t *)pContext) += getPooledSize(getNodeSize(pKey -> length));
+    return true;
+}
+
+/**
+ * A structure for the context of appendValue, a Linked List and the link after its last Node.
+ */
+typedef struct ListTail
+{
+    MyLinkedListP list;
+    Node **pTail;
+} ListTail;
+
+/**
+ * @brief Adds a Node of the given value to the end of the given Linked List, for copying the
+ *        values of a Linked List in order.
+ * @param pKey A pointer to the Value Key of the value.
+ * @param pContext A pointer to the ListTail of the Linked List.
+ * @return true iff succeed.
+ */
+static bool appendValue(ValueKey const *pKey, void *pContext)
+{
+    ListTail *pListTail = (ListTail *)pContext;
+    Node *pCopy = createNode(pListTail -> list -> pool, pKey);
+    if (pCopy == NULL)
+    {
+        return false;
+    }
+    *(pListTail -> pTail) = pCopy;
+    pListTail -> pTail = &(pCopy -> next);
+    (pListTail -> list -> size)++;
+    pListTail -> list -> bytes += getSizeOfNode(pCopy);
+    return true;
+}
+
+/**
+ * @brief Helper function for cloneList, which copies the values of the given Linked List of any
+ *        mode to the given empty regular Linked List, in the same order. The memory of all the
+ *        Nodes is reserved at once.
+ * @param pMyLinkedList A pointer to the copy.
+ * @param l A pointer to the Linked List to copy.
+ * @return true iff succeed.
+ */
+static bool copyValuesHelper(MyLinkedListP const pMyLinkedList, MyLinkedListP const l)
+{
+    size_t poolSize = NO_ALLOCATE_SIZE;
+    visitValues(l, addPooledSize, &poolSize);
+    if ((poolSize > NO_ALLOCATE_SIZE) && !(reservePool(pMyLinkedList -> pool, poolSize)))
+    {
+        return false;
+    }
+    ListTail tail = {pMyLinkedList, &(pMyLinkedList -> head)};
+    return visitValues(l, appendValue, &tail);
+}
+
+
+/**
+ * @brief Initialize the given List Writer.
+ * @param pWriter A pointer to the List Writer.
+ * @param stream The stream to write to, or NULL.
+ * @param fd The file descriptor to write to if there is no stream, or NO_FILE_DESCRIPTOR to write
+ *        to the buffer of the caller, which is set after the initialization.
+ */
+static void initializeWriter(ListWriter *pWriter, FILE *stream, int const fd)
+{
+    pWriter -> used = NO_ALLOCATE_SIZE;
+    pWriter -> stream = stream;
+    pWriter -> fd = fd;
+    pWriter -> target = NULL;
+    pWriter -> targetSize = NO_ALLOCATE_SIZE;
+    pWriter -> written = NO_ALLOCATE_SIZE;
+    pWriter -> failed = false;
+    return;
+}
+
+/**
+ * @brief Copies the bytes in the buffer of the given List Writer to the buffer of the caller, as
+ *        many as fit in it before its terminator, and empties it. All the bytes are counted as
+ *        written, so the caller learns the size the whole output needs.
+ * @param pWriter A pointer to the List Writer.
+ */
+static void flushWriterToTarget(ListWriter *pWriter)
+{
+    int size = pWriter -> targetSize - STRING_TERMINATOR_COUNT - pWriter -> written;
+    if (size > pWriter -> used)
+    {
+        size = pWriter -> used;
+    }
+    if (size > NO_ALLOCATE_SIZE)
+    {
+        memcpy(pWriter -> target + pWriter -> written, pWriter -> buffer, size);
+    }
+    pWriter -> written += pWriter -> used;
+    pWriter -> used = NO_ALLOCATE_SIZE;
+    return;
+}
+
+/**
+ * @brief Writes the bytes in the buffer of the given List Writer and empties it.
+ *        A partial write is continued until all the bytes are written or a write fails.
+ * @param pWriter A pointer to the List Writer.
+ */
+static void flushWriter(ListWriter *pWriter)
+{
+    if ((pWriter -> stream == NULL) && (pWriter -> fd == NO_FILE_DESCRIPTOR))
+    {
+        flushWriterToTarget(pWriter);
+        return;
+    }
+    int position = NO_ALLOCATE_SIZE;
+    while (!(pWriter -> failed) && (position < pWriter -> used))
+    {
+        size_t const count = pWriter -> used - position;
+        long written = 0;
+        if (pWriter -> stream != NULL)
+        {
+            written = (long)fwrite(pWriter -> buffer + position, sizeof(char), count,
+                                   pWriter -> stream);
+        }
+        else
+        {
+            written = (long)write(pWriter -> fd, pWriter -> buffer + position, count);
+        }
+        if (written <= 0)
+        {
+            pWriter -> failed = true;
+        }
+        else
+        {
+            position += (int)written;
+        }
+    }
+    pWriter -> written += position;
+    pWriter -> used = NO_ALLOCATE_SIZE;
+    return;
+}
+
+/**
+ * @brief Adds the given bytes to the buffer of the given List Writer, and writes the buffer
+ *        whenever it is full.
+ * @param pWriter A pointer to the List Writer.
+ * @param bytes The bytes to add.
+ * @param count The number of bytes.
+ */
+static void addToWriter(ListWriter *pWriter, char const *bytes, int count)
+{
+    while (count > NO_ALLOCATE_SIZE)
+    {
+        if (pWriter -> used == WRITE_BUFFER_SIZE)
+        {
+            flushWriter(pWriter);
+        }
+        int size = WRITE_BUFFER_SIZE - pWriter -> used;
+        if (size > count)
+        {
+            size = count;
+        }
+        memcpy(pWriter -> buffer + pWriter -> used, bytes, size);
+        pWriter -> used += size;
+        bytes += size;
+        count -= size;
+    }
+    return;
+}
+
+/**
+ * @brief Adds the print of a single value to the given List Writer.
+ * @param pKey A pointer to the Value Key of the value.
+ * @param pContext A pointer to the List Writer.
+ * @return true, to continue the traversal.
+ */
+static bool addValueToWriter(ValueKey const *pKey, void *pContext)
+{
+    ListWriter *pWriter = (ListWriter *)pContext;
+    addToWriter(pWriter, NODE_OUTPUT_PREFIX, sizeof(NODE_OUTPUT_PREFIX) - STRING_TERMINATOR_COUNT);
+    addToWriter(pWriter, pKey -> value, pKey -> length);
+    addToWriter(pWriter, NODE_OUTPUT_SUFFIX, sizeof(NODE_OUTPUT_SUFFIX) - STRING_TERMINATOR_COUNT);
+    return true;
+}
+
+/**
+ * @brief Adds a single value to the given List Writer, in the format of a saved Linked List file.
+ * @param pKey A pointer to the Value Key of the value.
+ * @param pContext A pointer to the List Writer.
+ * @return true iff all the writes so far succeeded.
+ */
+static bool addEntryToWriter(ValueKey const *pKey, void *pContext)
+{
+    ListWriter *pWriter = (ListWriter *)pContext;
+    char const padding[LIST_FILE_ALIGNMENT] = {'\0'};
+    int const length = (int)pKey -> length;
+    int const size = (int)getEntrySize(length);
+    int const dataSize = length + STRING_TERMINATOR_COUNT;
+    addToWriter(pWriter, (char const *)&(pKey -> hash), sizeof(pKey -> hash));
+    addToWriter(pWriter, (char const *)&length, sizeof(length));
+    addToWriter(pWriter, pKey -> value, dataSize);
+    addToWriter(pWriter, padding, size - (int)sizeof(ListFileEntry) - dataSize);
+    return !(pWriter -> failed);
+}
+
+/**
+ * @brief Adds the print of the given Linked List and it's contents to the given List Writer, in
+ *        the format of printList.
+ * @param l A pointer to the Linked List.
+ * @param pWriter A pointer to the List Writer.
+ */
+static void addListToWriter(MyLinkedListP const l, ListWriter *pWriter)
+{
+    int const numberOfElements = l -> size;
+    assert(numberOfElements >= EMPTY_LIST_SIZE);
+    if (numberOfElements == EMPTY_LIST_SIZE)
+    {
+        addToWriter(pWriter, EMPTY_LIST_MESSAGE,
+                    sizeof(EMPTY_LIST_MESSAGE) - STRING_TERMINATOR_COUNT);
+        return;
+    }
+
+    visitValues(l, addValueToWriter, pWriter);
+
+    char end[END_OF_PRINT_BUFFER_SIZE];
+    int const endLength = snprintf(end, sizeof(end), END_OF_PRINT_OUTPUT, numberOfElements);
+    addToWriter(pWriter, end, endLength);
+    return;
+}
+
+
+/*-----=  Linked List Functions  =-----*/
+
+
+/**
+ * @brief Initialize a given pointer to a Linked List struct with the default values.
+ * @param pMyLinkedList The pointer to the Linked List to initialize.
+ */
+static void initializeList(MyLinkedListP pMyLinkedList)
+{
+    assert(pMyLinkedList != NULL);
+    pMyLinkedList -> mode = LINKED_MODE;
+    pMyLinkedList -> head = NULL;
+    pMyLinkedList -> firstBlock = NULL;
+    pMyLinkedList -> size = EMPTY_LIST_SIZE;
+    pMyLinkedList -> bytes = NO_ALLOCATE_SIZE;
+    pMyLinkedList -> pool = NULL;
+    pMyLinkedList -> index = NULL;
+    pMyLinkedList -> mapping = NULL;
+    pMyLinkedList -> mappingSize = NO_ALLOCATE_SIZE;
+    pMyLinkedList -> skipHeads = NULL;
+    pMyLinkedList -> skipHeight = 1;
+    pMyLinkedList -> skipRandom = SKIP_RANDOM_SEED;
+    return;
+}
+
+/**
+ * @brief Allocates a new empty Linked List.
+ * 		  It is the caller's responsibility to free the returned Linked List.
+ * @return A pointer to the new Linked List, or NULL if the allocation failed.
+ */
+MyLinkedListP createList()
+{
+    STATS_CALL(CREATE_LIST_CALL);
+    MyLinkedListP pMyLinkedList = NULL;
+    pMyLinkedList = (MyLinkedListP)malloc(sizeof(MyLinkedList));
+    if (pMyLinkedList != NULL)
+    {
+        initializeList(pMyLinkedList);
+        pMyLinkedList -> pool = createPool();
+        if (pMyLinkedList -> pool == NULL)
+        {
+            free(pMyLinkedList);
+            pMyLinkedList = NULL;
+        }
+    }
+    return pMyLinkedList;
+}
+
+/**
+ * @brief Allocates a new empty unrolled Linked List, which stores many values packed in each
+ *        Block instead of a single value in each Node.
+ * 		  It is the caller's responsibility to free the returned Linked List.
+ * @return A pointer to the new Linked List, or NULL if the allocation failed.
+ */
+MyLinkedListP createUnrolledList()
+{
+    STATS_CALL(CREATE_UNROLLED_LIST_CALL);
+    MyLinkedListP pMyLinkedList = createList();
+    if (pMyLinkedList != NULL)
+    {
+        pMyLinkedList -> mode = UNROLLED_MODE;
+    }
+    return pMyLinkedList;
+}
+
+/**
+ * @brief Allocates a new empty concurrent Linked List, which can be used by many threads at once.
+ *        insertFirst, insertMany, removeData, isInList, getSize and cloneList are thread safe for
+ *        it, and indexList is not supported. The other functions must not run with any other
+ *        operation.
+ * 		  It is the caller's responsibility to free the returned Linked List.
+ * @return A pointer to the new Linked List, or NULL if the allocation failed.
+ */
+MyLinkedListP createConcurrentList()
+{
+    STATS_CALL(CREATE_CONCURRENT_LIST_CALL);
+    MyLinkedListP pMyLinkedList = createList();
+    if (pMyLinkedList != NULL)
+    {
+        if (pthread_mutex_init(&(pMyLinkedList -> phaseLock), NULL) != 0)
+        {
+            freeList(pMyLinkedList);
+            return NULL;
+        }
+        int phase;
+        for (phase = 0; phase < READ_PHASES; phase++)
+        {
+            pMyLinkedList -> readers[phase] = 0;
+        }
+        pMyLinkedList -> readPhase = 0;
+        pMyLinkedList -> mode = CONCURRENT_MODE;
+    }
+    return pMyLinkedList;
+}
+
+/**
+ * @brief Allocates a new empty Intern Pool, which keeps a single copy of each value of the Linked
+ *        Lists created with it by createInternedList.
+ *        It is the caller's responsibility to free the returned Intern Pool.
+ * @return A pointer to the new Intern Pool, or NULL if the allocation failed.
+ */
+MyInternPoolP createInternPool()
+{
+    STATS_CALL(CREATE_INTERN_POOL_CALL);
+    MyInternPoolP pIntern = (MyInternPoolP)malloc(sizeof(MyInternPool));
+    if (pIntern != NULL)
+    {
+        pIntern -> strings = (InternedString **)calloc(INITIAL_INTERN_CAPACITY,
+                                                       sizeof(InternedString *));
+        if (pIntern -> strings == NULL)
+        {
+            free(pIntern);
+            return NULL;
+        }
+        pIntern -> capacity = INITIAL_INTERN_CAPACITY;
+        pIntern -> numberOfStrings = 0;
+        pIntern -> references = 1;
+    }
+    return pIntern;
+}
+
+/**
+ * @brief Frees the given Intern Pool. The Linked Lists created with it keep using it, and its
+ *        memory is freed with the last of them.
+ *        If the given Intern Pool is NULL, no operation is performed.
+ * @param pIntern A pointer to the Intern Pool to free.
+ */
+void freeInternPool(MyInternPoolP pIntern)
+{
+    STATS_CALL(FREE_INTERN_POOL_CALL);
+    releaseInternPool(pIntern);
+    return;
+}
+
+/**
+ * @brief Allocates a new empty Linked List whose Nodes point to the single copy of their value in
+ *        the given Intern Pool instead of holding a copy of their own. A string is freed with the
+ *        last Node which points to it, in any of the Linked Lists of the Intern Pool, and the
+ *        strings are not counted by getSizeOf. removeData and isInList look the value up in the
+ *        Intern Pool once and then compare pointers only.
+ *        The Linked Lists of an Intern Pool must not be used by more than a single thread at once.
+ * 		  It is the caller's responsibility to free the returned Linked List.
+ * @param pIntern A pointer to the Intern Pool.
+ * @return A pointer to the new Linked List, or NULL if the allocation failed.
+ */
+MyLinkedListP createInternedList(MyInternPoolP pIntern)
+{
+    STATS_CALL(CREATE_INTERNED_LIST_CALL);
+    if (pIntern == NULL)
+    {
+        return NULL;
+    }
+    MyLinkedListP pMyLinkedList = createList();
+    if (pMyLinkedList != NULL)
+    {
+        pMyLinkedList -> pool -> intern = pIntern;
+        (pIntern -> references)++;
+    }
+    return pMyLinkedList;
+}
+
+/**
+ * @brief Allocates a new empty ordered Linked List, which keeps its values sorted in the order of
+ *        strcmp in a skip list: each Node is also linked in a random number of higher levels,
+ *        each with about a quarter of the Nodes of the level below it. isInList, removeData and
+ *        insertFirst, which adds the value in its place, search from the highest level down and
+ *        take O(log n) expected time. The other functions see a regular sorted Linked List.
+ *        sortList succeeds only with strcmp, and cloneList copies the Nodes.
+ * 		  It is the caller's responsibility to free the returned Linked List.
+ * @return A pointer to the new Linked List, or NULL if the allocation failed.
+ */
+MyLinkedListP createOrderedList()
+{
+    STATS_CALL(CREATE_ORDERED_LIST_CALL);
+    MyLinkedListP pMyLinkedList = createList();
+    if (pMyLinkedList != NULL)
+    {
+        pMyLinkedList -> skipHeads = (Node **)calloc(SKIP_MAX_HEIGHT, sizeof(Node *));
+        if (pMyLinkedList -> skipHeads == NULL)
+        {
+            freeList(pMyLinkedList);
+            return NULL;
+        }
+        pMyLinkedList -> mode = ORDERED_MODE;
+    }
+    return pMyLinkedList;
+}
+
+/**
+ * @brief Allocates a new empty doubly linked Linked List, whose Nodes are linked to the previous
+ *        Node too, so insertFirstNode can return a handle of a Node which removeNode removes in
+ *        constant time. The Nodes are never moved, so a handle is valid until its Node is
+ *        removed, and cloneList copies the Nodes.
+ * 		  It is the caller's responsibility to free the returned Linked List.
+ * @return A pointer to the new Linked List, or NULL if the allocation failed.
+ */
+MyLinkedListP createDoublyLinkedList()
+{
+    STATS_CALL(CREATE_DOUBLY_LINKED_LIST_CALL);
+    MyLinkedListP pMyLinkedList = createList();
+    if (pMyLinkedList != NULL)
+    {
+        pMyLinkedList -> mode = DOUBLY_LINKED_MODE;
+    }
+    return pMyLinkedList;
+}
+
+/**
+ * @brief Allocates a new Linked List which shares all the Nodes and the Node Pool of the given
+ *        Linked List, so no Node is copied until one of them removes a shared Node.
+ * @param l A pointer to the Linked List to share.
+ * @return A pointer to the new Linked List, or NULL if the allocation failed.
+ */
+static MyLinkedListP shareList(MyLinkedListP const l)
+{
+    MyLinkedListP pMyLinkedList = (MyLinkedListP)malloc(sizeof(MyLinkedList));
+    if (pMyLinkedList != NULL)
+    {
+        initializeList(pMyLinkedList);
+        pMyLinkedList -> pool = l -> pool;
+        (l -> pool -> references)++;
+        pMyLinkedList -> head = l -> head;
+        if (l -> head != NULL)
+        {
+            (l -> head -> references)++;
+        }
+        pMyLinkedList -> size = l -> size;
+        pMyLinkedList -> bytes = l -> bytes;
+    }
+    return pMyLinkedList;
+}
+
+/**
+ * @brief Allocates a new MyLinkedList with the same values as given Linked List.
+ *        A regular Linked List shares its Nodes with the clone, so cloning takes constant time
+ *        (with no Index) and the Nodes are copied only when a shared Node is removed.
+ *        The clone of a mapped Linked List is a regular Linked List which can be changed.
+ *        The Nodes of the other modes are copied.
+ *        It is the caller's responsibility to free the returned Linked List.
+ * @param l A pointer to the Linked List to clone.
+ * @return A pointer to the new cloned Linked List, or NULL if the allocation failed.
+ */
+MyLinkedListP cloneList(MyLinkedListP const l)
+{
+    STATS_CALL(CLONE_LIST_CALL);
+    MyLinkedListP clone = NULL;
+    if (l != NULL)
+    {
+        if (l -> mode == LINKED_MODE)
+        {
+            clone = shareList(l);
+        }
+        else
+        {
+            clone = (l -> mode == CONCURRENT_MODE) ? createConcurrentList() :
+                    (l -> mode == ORDERED_MODE) ? createOrderedList() : createList();
+        }
+        if (clone != NULL)
+        {
+            clone -> mode = (l -> mode == MAPPED_MODE) ? LINKED_MODE : l -> mode;
+            bool success = true;
+            if (l -> mode == MAPPED_MODE)
+            {
+                success = copyValuesHelper(clone, l);
+            }
+            else if (l -> mode == CONCURRENT_MODE)
+            {
+                success = cloneConcurrentHelper(clone, l);
+            }
+            else if (l -> mode == UNROLLED_MODE)
+            {
+                success = cloneUnrolledHelper(clone, l -> firstBlock);
+            }
+            else if (l -> mode == ORDERED_MODE)
+            {
+                success = cloneOrderedHelper(clone, l);
+            }
+            else if (l -> mode == DOUBLY_LINKED_MODE)
+            {
+                success = cloneDoublyHelper(clone, l);
+            }
+            if (success && (l -> index != NULL))
+            {
+                clone -> index = cloneIndex(l -> index);
+                success = (clone -> index != NULL);
+            }
+            if (!success)
+            {
+                // Unsuccessful Linked List cloning.
+                freeList(clone);
+                clone = NULL;
+            }
+        }
+    }
+    return clone;
+}
+
+/**
+ * @brief Frees the memory and resources allocated to the given Linked List.
+ *        If the given Linked List is NULL, no operation is performed.
+ * @param l A pointer to the Linked List to free.
+ */
+void freeList(MyLinkedListP l)
+{
+    STATS_CALL(FREE_LIST_CALL);
+    if (l != NULL)
+    {
+        if (l -> mode == CONCURRENT_MODE)
+        {
+            Node *currentNode = l -> head;
+            while (currentNode != NULL)
+            {
+                currentNode = freeConcurrentNode(currentNode);
+            }
+            pthread_mutex_destroy(&(l -> phaseLock));
+        }
+        else if (l -> mode == MAPPED_MODE)
+        {
+            munmap((void *)l -> mapping, l -> mappingSize);
+        }
+        else if ((l -> pool -> references > 1) || (l -> pool -> intern != NULL))
+        {
+            // The Nodes which are not shared go back to the Node Pool, which clones still use,
+            // and release their interned strings.
+            Node *currentNode = l -> head;
+            while ((currentNode != NULL) && (currentNode -> references == 1))
+            {
+                currentNode = freeNode(l -> pool, currentNode);
+            }
+            if (currentNode != NULL)
+            {
+                (currentNode -> references)--;
+            }
+        }
+        // The Nodes and their data are freed together with their Node Pool.
+        releasePool(l -> pool);
+        freeIndex(l -> index);
+        free(l -> skipHeads);
+        free(l);
+    }
+    return;
+}
+
+/**
+ * @brief Print the given Linked List and it's contents.
+ *        The whole output is collected in a buffer and written to the standard output at once.
+ * @param l A pointer to the Linked List to print.
+ */
+void printList(MyLinkedListP const l)
+{
+    STATS_CALL(PRINT_LIST_CALL);
+    if (l != NULL)
+    {
+        ListWriter writer;
+        initializeWriter(&writer, stdout, NO_FILE_DESCRIPTOR);
+        addListToWriter(l, &writer);
+        flushWriter(&writer);
+    }
+    return;
+}
+
+/**
+ * @brief Writes the given Linked List and it's contents to the given file descriptor, in the
+ *        format of printList. The output is collected in a buffer of WRITE_BUFFER_SIZE bytes, so
+ *        a Linked List which fits in it takes a single write, and no memory is allocated.
+ * @param l A pointer to the Linked List to write.
+ * @param fd The file descriptor to write to.
+ * @return The number of bytes written, or MYLIST_ERROR_CODE if an error occurred.
+ */
+int writeList(MyLinkedListP const l, int const fd)
+{
+    STATS_CALL(WRITE_LIST_CALL);
+    if ((l == NULL) || (fd < 0))
+    {
+        return MYLIST_ERROR_CODE;
+    }
+    ListWriter writer;
+    initializeWriter(&writer, NULL, fd);
+    addListToWriter(l, &writer);
+    flushWriter(&writer);
+    return writer.failed ? MYLIST_ERROR_CODE : writer.written;
+}
+
+/**
+ * @brief Writes the given Linked List and it's contents to the given buffer, in the format of
+ *        printList, as snprintf does: at most size - 1 bytes of the output are written, followed
+ *        by a terminator if size is positive. No memory is allocated, and a NULL buffer with size
+ *        0 only measures the output.
+ * @param l A pointer to the Linked List to write.
+ * @param buffer The buffer to write to.
+ * @param size The number of bytes in the buffer.
+ * @return The number of bytes of the whole output, without the terminator, which were all written
+ *         iff it is less than size, or MYLIST_ERROR_CODE if an error occurred.
+ */
+int writeListToBuffer(MyLinkedListP const l, char *buffer, int const size)
+{
+    STATS_CALL(WRITE_LIST_TO_BUFFER_CALL);
+    if ((l == NULL) || (size < NO_ALLOCATE_SIZE) || ((buffer == NULL) && (size > NO_ALLOCATE_SIZE)))
+    {
+        return MYLIST_ERROR_CODE;
+    }
+    ListWriter writer;
+    initializeWriter(&writer, NULL, NO_FILE_DESCRIPTOR);
+    writer.target = buffer;
+    writer.targetSize = size;
+    addListToWriter(l, &writer);
+    flushWriter(&writer);
+    if (size > NO_ALLOCATE_SIZE)
+    {
+        buffer[(writer.written < size) ? writer.written : size - STRING_TERMINATOR_COUNT] = '\0';
+    }
+    return writer.written;
+}
+
+/**
+ * @brief Saves the values of the given Linked List to the file in the given path, in order, in a
+ *        compact format: a header with the number of values, followed by each value with its
+ *        hash value and length, so loadList and mapList do not hash or measure them again.
+ *        The output is collected in a buffer of WRITE_BUFFER_SIZE bytes and no memory is
+ *        allocated. The file is in the byte order of this machine.
+ * @param l A pointer to the Linked List to save.
+ * @param path The path of the file, which is created or replaced.
+ * @return true iff succeed.
+ */
+bool saveList(MyLinkedListP const l, char const *path)
+{
+    STATS_CALL(SAVE_LIST_CALL);
+    if ((l == NULL) || (path == NULL))
+    {
+        return false;
+    }
+    int const fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, LIST_FILE_MODE);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    ListWriter writer;
+    initializeWriter(&writer, NULL, fd);
+    ListFileHeader header;
+    memcpy(header.magic, LIST_FILE_MAGIC, LIST_FILE_MAGIC_SIZE);
+    header.count = getSize(l);
+    addToWriter(&writer, (char const *)&header, sizeof(header));
+    visitValues(l, addEntryToWriter, &writer);
+    flushWriter(&writer);
+    bool const success = (close(fd) == 0) && !(writer.failed);
+    return success;
+}
+
+/**
+ * @brief Allocates a new read only Linked List whose values are read directly from a mapping of
+ *        the file in the given path, which was written by saveList. No memory is allocated for
+ *        the values: isInList, iterateList, foldList, printList, writeList, saveList, getSize and
+ *        getSizeOf read them from the mapping, and indexList may build an Index for them.
+ *        The functions which change a Linked List return an error for it, and cloneList returns
+ *        a regular Linked List with its values. The file must not be changed while it is mapped.
+ *        It is the caller's responsibility to free the returned Linked List.
+ * @param path The path of the file.
+ * @return A pointer to the new Linked List, or NULL if the file is not valid or an error occurred.
+ */
+MyLinkedListP mapList(char const *path)
+{
+    STATS_CALL(MAP_LIST_CALL);
+    if (path == NULL)
+    {
+        return NULL;
+    }
+    int const fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return NULL;
+    }
+    struct stat fileStatus;
+    if ((fstat(fd, &fileStatus) != 0) || (fileStatus.st_size < (off_t)sizeof(ListFileHeader)))
+    {
+        close(fd);
+        return NULL;
+    }
+    size_t const size = (size_t)fileStatus.st_size;
+    void *mapping = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED)
+    {
+        return NULL;
+    }
+
+    int const numberOfElements = checkListFile((char const *)mapping, size);
+    MyLinkedListP pMyLinkedList = NULL;
+    if (numberOfElements != MYLIST_ERROR_CODE)
+    {
+        pMyLinkedList = createList();
+    }
+    if (pMyLinkedList == NULL)
+    {
+        munmap(mapping, size);
+        return NULL;
+    }
+    pMyLinkedList -> mode = MAPPED_MODE;
+    pMyLinkedList -> mapping = (char const *)mapping;
+    pMyLinkedList -> mappingSize = size;
+    pMyLinkedList -> size = numberOfElements;
+    pMyLinkedList -> bytes = (int)size;
+    STATS_MAX(peakSize, numberOfElements);
+    return pMyLinkedList;
+}
+
+/**
+ * @brief Allocates a new Linked List with the values saved by saveList in the file in the given
+ *        path, in the same order. The memory of all the Nodes is reserved at once.
+ *        It is the caller's responsibility to free the returned Linked List.
+ * @param path The path of the file.
+ * @return A pointer to the new Linked List, or NULL if the file is not valid or an error occurred.
+ */
+MyLinkedListP loadList(char const *path)
+{
+    STATS_CALL(LOAD_LIST_CALL);
+    MyLinkedListP pMapped = mapList(path);
+    MyLinkedListP pMyLinkedList = cloneList(pMapped);
+    freeList(pMapped);
+    return pMyLinkedList;
+}
+
+/**
+ * @brief Remove all the occurrences of val in the given Linked List.
+ * @param l A pointer to the Linked List to remove from.
+ * @param val The value to remove, a (char *) value type.
+ * @return The Number of elements that were removed, or MYLIST_ERROR_CODE if an error occurred.
+ */
+int removeData(MyLinkedListP l, char const *val)
+{
+    STATS_CALL(REMOVE_DATA_CALL);
+    if ((l == NULL) || (val == NULL))
+    {
+        return MYLIST_ERROR_CODE;
+    }
+
+    ValueKey key = createKey(val);
+    if (l -> mode == CONCURRENT_MODE)
+    {
+        return removeConcurrentData(l, &key);
+    }
+    if (l -> mode == MAPPED_MODE)
+    {
+        return MYLIST_ERROR_CODE;
+    }
+
+    int const numberOfElements = l -> size;
+    assert(numberOfElements >= EMPTY_LIST_SIZE);
+
+    // With an Index we know how many Nodes to remove, so we can stop after the last of them.
+    int remainingOccurrences = numberOfElements;
+    if (l -> index != NULL)
+    {
+        remainingOccurrences = countInIndex(l -> index, &key);
+        if (remainingOccurrences == NO_OCCURRENCES)
+        {
+            return NO_OCCURRENCES;
+        }
+    }
+
+    int numberOfOccurrences = NO_OCCURRENCES;
+    if (l -> mode == UNROLLED_MODE)
+    {
+        numberOfOccurrences = removeUnrolledData(l, &key, remainingOccurrences);
+    }
+    else if (l -> mode == ORDERED_MODE)
+    {
+        numberOfOccurrences = removeOrderedData(l, &key, remainingOccurrences);
+    }
+    else if (l -> pool -> intern != NULL)
+    {
+        // A value which is not interned is not in any Linked List of the Intern Pool.
+        char const *value = lookupValue(l -> pool -> intern, &key);
+        if (value == NULL)
+        {
+            return NO_OCCURRENCES;
+        }
+        numberOfOccurrences = removeLinkedNodes(l, matchInternedNode, (void *)value, NULL,
+                                                remainingOccurrences);
+    }
+    else
+    {
+        numberOfOccurrences = removeLinkedNodes(l, matchNodeKey, &key, NULL,
+                                                remainingOccurrences);
+    }
+    if ((l -> index != NULL) && (numberOfOccurrences != MYLIST_ERROR_CODE))
+    {
+        removeFromIndex(l -> index, &key, numberOfOccurrences);
+    }
+    return numberOfOccurrences;
+}
+
+/**
+ * @brief Adds the given value to the beginning of the Linked List
+ *        (the Linked List may contain duplicates), or in its place in an ordered Linked List.
+          'val' may be changed/deleted and your Linked List should not be effected by that.
+ * @param l A pointer to the LinkedList to add the value to.
+ * @param val The value to add, a (char *) value type.
+ * @return true iff succeed.
+ */
+bool insertFirst(MyLinkedListP l, char const *val)
+{
+    STATS_CALL(INSERT_FIRST_CALL);
+    if ((l != NULL) && (val != NULL) && (l -> mode != MAPPED_MODE))
+    {
+        ValueKey const key = createKey(val);
+        if (l -> mode == CONCURRENT_MODE)
+        {
+            return insertFirstConcurrent(l, &key);
+        }
+        if (l -> mode == UNROLLED_MODE)
+        {
+            if (!insertFirstUnrolled(l, &key))
+            {
+                return false;
+            }
+            if ((l -> index != NULL) && !(addToIndex(l -> index, &key)))
+            {
+                removeUnrolledFirst(l);
+                return false;
+            }
+            STATS_MAX(peakSize, l -> size);
+            return true;
+        }
+        if (l -> mode == ORDERED_MODE)
+        {
+            if (!insertOrdered(l, &key))
+            {
+                return false;
+            }
+            if ((l -> index != NULL) && !(addToIndex(l -> index, &key)))
+            {
+                removeOrderedData(l, &key, 1);
+                return false;
+            }
+            STATS_MAX(peakSize, l -> size);
+            return true;
+        }
+
+        Node *currentHead = l -> head;
+        Node *newHead = (l -> mode == DOUBLY_LINKED_MODE) ? createDoublyNode(l -> pool, &key) :
+                                                            createNode(l -> pool, &key);
+        if ((newHead != NULL) && (l -> index != NULL) && !(addToIndex(l -> index, &key)))
+        {
+            releaseNode(l, newHead);
+            newHead = NULL;
+        }
+        if (newHead != NULL)
+        {
+            newHead -> next = currentHead;
+            setPreviousNode(l, currentHead, newHead);
+            l -> head = newHead;
+            (l -> size)++;
+            l -> bytes += getListNodeSize(l, newHead);
+            STATS_MAX(peakSize, l -> size);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Adds the given value to the beginning of the given doubly linked Linked List, as
+ *        insertFirst does, and returns a handle of its Node.
+ * @param l A pointer to the LinkedList to add the value to, which was created by
+ *        createDoublyLinkedList.
+ * @param val The value to add, a (char *) value type.
+ * @return The handle of the new Node, which is valid until the Node is removed, or NULL if an
+ *         error occurred.
+ */
+MyListNodeP insertFirstNode(MyLinkedListP l, char const *val)
+{
+    STATS_CALL(INSERT_FIRST_NODE_CALL);
+    if ((l == NULL) || (l -> mode != DOUBLY_LINKED_MODE) || !(insertFirst(l, val)))
+    {
+        return NULL;
+    }
+    return (MyListNodeP)l -> head;
+}
+
+/**
+ * @brief Removes the Node of the given handle from the given doubly linked Linked List in
+ *        constant time, by linking its previous and next Nodes to each other.
+ * @param l A pointer to the Linked List to remove from.
+ * @param node The handle of a Node of the Linked List, which was returned by insertFirstNode and
+ *        was not removed yet. The handle is not valid after the call.
+ * @return true iff succeed.
+ */
+bool removeNode(MyLinkedListP l, MyListNodeP node)
+{
+    STATS_CALL(REMOVE_NODE_CALL);
+    if ((l == NULL) || (node == NULL) || (l -> mode != DOUBLY_LINKED_MODE))
+    {
+        return false;
+    }
+    Node *pNode = (Node *)node;
+    assert(l -> size > EMPTY_LIST_SIZE);
+    if (l -> index != NULL)
+    {
+        ValueKey const key = getNodeKey(pNode);
+        removeFromIndex(l -> index, &key, 1);
+    }
+    unlinkDoublyNode(l, pNode);
+    l -> bytes -= getListNodeSize(l, pNode);
+    releaseNode(l, pNode);
+    (l -> size)--;
+    return true;
+}
+
+/**
+ * @brief Search the given value in the Linked List.
+ * @param l A pointer to the LinkedList to search in.
+ * @param val The value to search for, a (char *) value type.
+ * @return The number of occurrences of the given value in the Linked List,
+ *         or MYLIST_ERROR_CODE if an error occurred.
+ */
+int isInList(MyLinkedListP const l, char const *val)
+{
+    STATS_CALL(IS_IN_LIST_CALL);
+    if ((l != NULL) && (val != NULL))
+    {
+        ValueKey const key = createKey(val);
+        if (l -> index != NULL)
+        {
+            return countInIndex(l -> index, &key);
+        }
+        if (l -> mode == UNROLLED_MODE)
+        {
+            return countUnrolled(l, &key);
+        }
+        if (l -> mode == ORDERED_MODE)
+        {
+            return countOrdered(l, &key);
+        }
+        if (l -> mode == CONCURRENT_MODE)
+        {
+            ValueCount count = {&key, NO_OCCURRENCES};
+            visitConcurrent(l, countConcurrentNode, &count);
+            return count.numberOfOccurrences;
+        }
+        if (l -> mode == MAPPED_MODE)
+        {
+            ValueCount count = {&key, NO_OCCURRENCES};
+            visitValues(l, countValue, &count);
+            return count.numberOfOccurrences;
+        }
+
+        int numberOfOccurrences = NO_OCCURRENCES;
+
+        Node *currentNode = l -> head;
+        if (l -> pool -> intern != NULL)
+        {
+            char const *value = lookupValue(l -> pool -> intern, &key);
+            while ((value != NULL) && (currentNode != NULL))
+            {
+                if (matchInternedNode(currentNode, (void *)value) != VALUE_NOT_FOUND)
+                {
+                    numberOfOccurrences++;
+                }
+                currentNode = currentNode -> next;
+            }
+            return numberOfOccurrences;
+        }
+        while (currentNode != NULL)
+        {
+            if (isNodeEqual(currentNode, &key))
+            {
+                numberOfOccurrences++;
+            }
+
+            currentNode = currentNode -> next;
+        }
+        return numberOfOccurrences;
+
+    }
+    else
+    {
+        return MYLIST_ERROR_CODE;
+    }
+}
+
+/**
+ * @brief Gets the size of the given Linked List.
+ * @param l A pointer to the Linked List.
+ * @return The number of elements in the Linked List, or MYLIST_ERROR_CODE if an error occurred.
+ */
+int getSize(MyLinkedListP const l)
+{
+    STATS_CALL(GET_SIZE_CALL);
+    if (l != NULL)
+    {
+        int const numberOfElements = __atomic_load_n(&(l -> size), __ATOMIC_RELAXED);
+        assert(numberOfElements >= EMPTY_LIST_SIZE);
+        return numberOfElements;
+    }
+    else
+    {
+        return MYLIST_ERROR_CODE;
+    }
+}
+
+#ifndef NDEBUG
+/**
+ * @brief Counts the size in bytes of the given Linked List and all it's contents by going over
+ *        all of them, to check the size which getSizeOf keeps in debug builds.
+ * @param l A pointer to the Linked List.
+ * @return The allocated size for to the Linked List.
+ */
+static int countSizeOf(MyLinkedListP const l)
+{
+    int sizeOf = sizeof(MyLinkedList) + (int)(l -> mappingSize);
+    UnrolledBlock const *currentBlock = l -> firstBlock;
+    while (currentBlock != NULL)
+    {
+        sizeOf += getBlockSize(currentBlock);
+        currentBlock = currentBlock -> next;
+    }
+
+    int const numberOfElements = (l -> size);
+    assert(numberOfElements >= EMPTY_LIST_SIZE);
+    Node *currentNode = l -> head;
+
+    // Add the sizeof for each Node in the Linked List.
+    int i = 0;
+    while ((l -> mode != UNROLLED_MODE) && (l -> mode != MAPPED_MODE) && (i < numberOfElements))
+    {
+        assert(currentNode != NULL);
+        sizeOf += getListNodeSize(l, currentNode);
+        currentNode = currentNode -> next;
+        i++;
+    }
+    return sizeOf;
+}
+#endif
+
+/**
+ * @brief Returns the size in bytes of the given Linked List and all it's contents.
+ *		  Equivalent to sum of sizeof for all the Linked List contents.
+ *		  The size of the contents is kept up to date by every operation, so it takes constant
+ *		  time. Nodes which are shared with clones are counted in each of the Linked Lists.
+ * @param l A pointer to the Linked List.
+ * @return The allocated size for to the Linked List.
  */
-MyLinkedListP createList()
+int getSizeOf(MyLinkedListP const l)
 {
-    MyLinkedListP pMyLinkedList = NULL;
-    pMyLinkedList = (MyLinkedListP)malloc(sizeof(MyLinkedList));
-    if (pMyLinkedList != NULL)
+    STATS_CALL(GET_SIZE_OF_CALL);
+    int sizeOf = NO_ALLOCATE_SIZE;
+    if (l != NULL)
     {
-        initializeList(pMyLinkedList);
+        sizeOf += sizeof(MyLinkedList);
+        sizeOf += __atomic_load_n(&(l -> bytes), __ATOMIC_RELAXED);
+        assert(sizeOf == countSizeOf(l));
     }
-    return pMyLinkedList;
+    return sizeOf;
 }
 
 /**
- * @brief Helper function for cloneList, which clones each Node recursively to the given
- *        pointer for the clone List.
- * @param pMyLinkedList A pointer for the clone Linked List.
- * @param pNode A pointer to the current Node to clone.
+ * @brief Builds an Index for the given Linked List, which maps each of its values to the number
+ *        of its occurrences. The Index is kept up to date by all the following operations and is
+ *        copied by cloneList, so isInList takes constant time and removeData returns immediately
+ *        if the value is not in the Linked List.
+ *        If the Linked List is already indexed, no operation is performed.
+ *        A concurrent Linked List can not be indexed.
+ * @param l A pointer to the Linked List to index.
  * @return true iff succeed.
  */
-static bool cloneListHelper(MyLinkedListP const pMyLinkedList, Node * const pNode)
+bool indexList(MyLinkedListP l)
 {
-    if (pNode == NULL)
+    STATS_CALL(INDEX_LIST_CALL);
+    if ((l == NULL) || (l -> mode == CONCURRENT_MODE))
+    {
+        return false;
+    }
+    if (l -> index != NULL)
     {
         return true;
     }
-    cloneListHelper(pMyLinkedList, pNode -> next);
-    return insertFirst(pMyLinkedList, pNode -> data);
+
+    ListIndex *pIndex = createIndex(INITIAL_INDEX_CAPACITY);
+    if (pIndex == NULL)
+    {
+        return false;
+    }
+    if (!(visitValues(l, addValueToIndex, pIndex)))
+    {
+        freeIndex(pIndex);
+        return false;
+    }
+    l -> index = pIndex;
+    return true;
 }
 
 /**
- * @brief Allocates a new MyLinkedList with the same values as given Linked List.
- *        It is the caller's responsibility to free the returned Linked List.
- * @param l A pointer to the Linked List to clone.
- * @return A pointer to the new cloned Linked List, or NULL if the allocation failed.
+ * @brief Sets the given Iterator to the first value of the given Linked List.
+ *        The Iterator is valid as long as the Linked List is not changed.
+ * @param l A pointer to the Linked List to iterate.
+ * @param iterator A pointer to the Iterator to set.
+ * @return true iff succeed.
  */
-MyLinkedListP cloneList(MyLinkedListP const l)
+bool iterateList(MyLinkedListP const l, MyListIterator *iterator)
 {
-    MyLinkedListP clone = NULL;
-    if (l != NULL)
+    STATS_CALL(ITERATE_LIST_CALL);
+    if ((l == NULL) || (iterator == NULL))
     {
-        clone = createList();
-        if (clone != NULL)
+        return false;
+    }
+    iterator -> list = l;
+    iterator -> position = EMPTY_LIST_SIZE;
+    if (l -> mode == UNROLLED_MODE)
+    {
+        iterator -> current = l -> firstBlock;
+        if (l -> firstBlock != NULL)
         {
-            if (!(cloneListHelper(clone, l -> head)))
-            {
-                // Unsuccessful Linked List cloning.
-                freeList(clone);
-                clone = NULL;
-            }
+            iterator -> position = l -> firstBlock -> count - 1;
         }
     }
-    return clone;
+    else if (l -> mode == MAPPED_MODE)
+    {
+        iterator -> current = (l -> size > EMPTY_LIST_SIZE) ? getFirstEntry(l -> mapping) : NULL;
+        iterator -> position = l -> size;
+    }
+    else
+    {
+        iterator -> current = l -> head;
+    }
+    return true;
 }
 
 /**
- * @brief Frees the memory and resources allocated to the given Linked List.
- *        If the given Linked List is NULL, no operation is performed.
- * @param l A pointer to the Linked List to free.
+ * @brief Gets the value the given Iterator points to and advances it to the next value.
+ *        The value is not copied, it is valid as long as it is in the Linked List.
+ * @param iterator A pointer to the Iterator.
+ * @return A pointer to the value, or NULL if the Iterator passed the last value.
  */
-void freeList(MyLinkedListP l)
+char const * nextInList(MyListIterator *iterator)
 {
-    if (l != NULL)
+    STATS_CALL(NEXT_IN_LIST_CALL);
+    if ((iterator == NULL) || (iterator -> current == NULL))
     {
+        return NULL;
+    }
 
-        if ((l -> head) != NULL)
+    if (iterator -> list -> mode == UNROLLED_MODE)
+    {
+        UnrolledBlock const *pBlock = (UnrolledBlock const *)iterator -> current;
+        char const *value = pBlock -> data + pBlock -> offsets[iterator -> position];
+        (iterator -> position)--;
+        if (iterator -> position < EMPTY_LIST_SIZE)
         {
-            int const numberOfElements = (l -> size);
-            assert(numberOfElements >= EMPTY_LIST_SIZE);
-            Node *currentNode = l -> head;
+            pBlock = pBlock -> next;
+            iterator -> current = pBlock;
+            iterator -> position = (pBlock != NULL) ? pBlock -> count - 1 : EMPTY_LIST_SIZE;
+        }
+        return value;
+    }
+    if (iterator -> list -> mode == MAPPED_MODE)
+    {
+        // The position is the number of values left, including the current one.
+        ListFileEntry const *pEntry = (ListFileEntry const *)iterator -> current;
+        (iterator -> position)--;
+        iterator -> current = NULL;
+        if (iterator -> position > EMPTY_LIST_SIZE)
+        {
+            iterator -> current = getNextEntry(pEntry);
+        }
+        return pEntry -> data;
+    }
 
-            // Free each Node in the Linked List.
-            int i = 0;
-            while (i < numberOfElements)
-            {
-                assert(currentNode != NULL);
-                currentNode = freeNode(currentNode);  // Current Node is now the next Node.
-                i++;
-            }
+    Node const *pNode = (Node const *)iterator -> current;
+    iterator -> current = pNode -> next;
+    return getNodeValue(pNode);
+}
+
+/**
+ * @brief Combines all the values of the given Linked List, from the first to the last, with the
+ *        given function. The function gets the result of the previous call, or the given initial
+ *        accumulator for the first value, and the value itself, which is not copied.
+ * @param l A pointer to the Linked List to fold.
+ * @param combine The function to combine the accumulator with a single value.
+ * @param accumulator The initial accumulator.
+ * @return The result of the last call, the initial accumulator if the Linked List is empty, or
+ *         NULL if an error occurred.
+ */
+void * foldList(MyLinkedListP const l, void * (*combine)(void *accumulator, char const *val),
+                void *accumulator)
+{
+    STATS_CALL(FOLD_LIST_CALL);
+    MyListIterator iterator;
+    if ((combine == NULL) || !(iterateList(l, &iterator)))
+    {
+        return NULL;
+    }
+    char const *value = nextInList(&iterator);
+    while (value != NULL)
+    {
+        accumulator = combine(accumulator, value);
+        value = nextInList(&iterator);
+    }
+    return accumulator;
+}
 
+/**
+ * @brief Removes the first value of the given Linked List, which is not empty, and updates its
+ *        Index.
+ * @param l A pointer to the Linked List.
+ */
+static void removeFirst(MyLinkedListP l)
+{
+    assert((l != NULL) && (l -> size > EMPTY_LIST_SIZE));
+    if (l -> mode == UNROLLED_MODE)
+    {
+        UnrolledBlock const *pBlock = l -> firstBlock;
+        int const position = pBlock -> count - 1;
+        ValueKey key;
+        key.value = pBlock -> data + pBlock -> offsets[position];
+        key.length = pBlock -> lengths[position];
+        key.hash = pBlock -> hashes[position];
+        if (l -> index != NULL)
+        {
+            removeFromIndex(l -> index, &key, 1);
         }
+        removeUnrolledFirst(l);
+        return;
+    }
 
-        // Free the Linked List itself.
-        free(l);
+    assert(l -> head -> references == 1);
+    ValueKey const key = getNodeKey(l -> head);
+    if (l -> index != NULL)
+    {
+        removeFromIndex(l -> index, &key, 1);
     }
+    l -> bytes -= getListNodeSize(l, l -> head);
+    l -> head = releaseNode(l, l -> head);
+    setPreviousNode(l, l -> head, NULL);
+    (l -> size)--;
     return;
 }
 
 /**
- * @brief Print the given Linked List and it's contents.
- * @param l A pointer to the Linked List to print.
+ * @brief Adds the given values to the beginning of the Linked List, one after the other, as if
+ *        insertFirst was called for each of them, so the last value becomes the first.
+ *        The memory of all the Nodes is reserved at once. Either all the values are added or none.
+ * @param l A pointer to the Linked List to add the values to.
+ * @param vals The values to add.
+ * @param k The number of values.
+ * @return true iff succeed.
  */
-void printList(MyLinkedListP const l)
+bool insertMany(MyLinkedListP l, char const * const *vals, int const k)
 {
-    if (l != NULL)
+    STATS_CALL(INSERT_MANY_CALL);
+    if ((l == NULL) || (vals == NULL) || (k < EMPTY_LIST_SIZE) || (l -> mode == MAPPED_MODE))
     {
-        int const numberOfElements = l -> size;
-        assert(numberOfElements >= EMPTY_LIST_SIZE);
+        return false;
+    }
 
-        // Printing process.
-        if (numberOfElements == EMPTY_LIST_SIZE)
+    size_t poolSize = NO_ALLOCATE_SIZE;
+    int i = 0;
+    while (i < k)
+    {
+        if (vals[i] == NULL)
+        {
+            return false;
+        }
+        if (l -> pool -> intern != NULL)
         {
-            printf(EMPTY_LIST_MESSAGE);
+            poolSize += getPooledSize(INTERNED_NODE_SIZE);
         }
         else
         {
-            assert((l -> head) != NULL);
-            Node *currentNode = l -> head;
-            int i = 0;
-            while (i < numberOfElements)
+            poolSize += getPooledSize(getNodeSize(strlen(vals[i])));
+        }
+        i++;
+    }
+    if (l -> mode == CONCURRENT_MODE)
+    {
+        // The rollback below removes the first values, which may be inserted by other threads.
+        return (k == EMPTY_LIST_SIZE) || insertManyConcurrent(l, vals, k);
+    }
+    if ((l -> mode == LINKED_MODE) && (poolSize > NO_ALLOCATE_SIZE) &&
+        !(reservePool(l -> pool, poolSize)))
+    {
+        return false;
+    }
+
+    int inserted = 0;
+    while ((inserted < k) && insertFirst(l, vals[inserted]))
+    {
+        inserted++;
+    }
+    if (inserted < k)
+    {
+        // Unsuccessful insertion, remove the values which were added.
+        while (inserted > EMPTY_LIST_SIZE)
+        {
+            inserted--;
+            if (l -> mode == ORDERED_MODE)
             {
-                assert(currentNode != NULL);
-                assert((currentNode -> data) != NULL);
-                printf(PRINT_NODE_OUTPUT, currentNode -> data);
-                currentNode = currentNode -> next;
-                i++;
+                // The values of an ordered Linked List are not first, so each is found by value.
+                ValueKey const key = createKey(vals[inserted]);
+                removeOrderedData(l, &key, 1);
+                if (l -> index != NULL)
+                {
+                    removeFromIndex(l -> index, &key, 1);
+                }
+            }
+            else
+            {
+                removeFirst(l);
             }
-            printf(END_OF_PRINT_OUTPUT, numberOfElements);
         }
+        return false;
     }
-    return;
+    return true;
 }
 
 /**
- * @brief Remove all the occurrences of val in the given Linked List.
+ * @brief Removes all the occurrences of all the given values from the Linked List, in a single
+ *        scan. The values are put in a temporary hash set, and each value of the Linked List is
+ *        looked up in it.
  * @param l A pointer to the Linked List to remove from.
- * @param val The value to remove, a (char *) value type.
- * @return The Number of elements that were removed, or MYLIST_ERROR_CODE if an error occurred.
+ * @param vals The values to remove, which may contain duplicates.
+ * @param k The number of values.
+ * @param counts An array of k counters to store the number of removed occurrences of each value,
+ *        or NULL.
+ * @return The number of elements that were removed, or MYLIST_ERROR_CODE if an error occurred.
  */
-int removeData(MyLinkedListP l, char const *val)
+int removeMany(MyLinkedListP l, char const * const *vals, int const k, int *counts)
 {
-    if ((l == NULL) || (val == NULL))
+    STATS_CALL(REMOVE_MANY_CALL);
+    if ((l == NULL) || (vals == NULL) || (k < EMPTY_LIST_SIZE) || (l -> mode == MAPPED_MODE))
     {
         return MYLIST_ERROR_CODE;
     }
+    int i = 0;
+    while (i < k)
+    {
+        if (vals[i] == NULL)
+        {
+            return MYLIST_ERROR_CODE;
+        }
+        i++;
+    }
 
-    int const numberOfElements = l -> size;
-    assert(numberOfElements >= EMPTY_LIST_SIZE);
-
-    int numberOfOccurrences = NO_OCCURRENCES;
-
-    if ((l -> head))
+    ValueSet set;
+    if (!createValueSet(&set, vals, k))
     {
-        Node *currentNode = l -> head;
-        Node *previousNode = NULL;
+        return MYLIST_ERROR_CODE;
+    }
 
-        int i = 0;
-        while (i < numberOfElements)
+    // With an Index we know how many values to remove, so we can stop after the last of them.
+    int remainingOccurrences = l -> size;
+    if (l -> index != NULL)
+    {
+        remainingOccurrences = NO_OCCURRENCES;
+        i = 0;
+        while (i < k)
         {
-            assert(currentNode != NULL);
-            assert((currentNode -> data) != NULL);
-
-            // If we found a Node to remove.
-            if (strcmp((currentNode -> data), val) == STRING_EQUALITY)
+            if (findInValueSet(&set, &(set.keys[i]), NULL) == i)
             {
-                if (previousNode == NULL)  // In case the Node to delete is the Head Node.
-                {
-                    l -> head = currentNode -> next;
-                }
-                else
-                {
-                    previousNode -> next = currentNode -> next;
-                }
-                (l -> size)--;
-                currentNode = freeNode(currentNode);  // Current Node is now next Node.
-                numberOfOccurrences++;
+                remainingOccurrences += countInIndex(l -> index, &(set.keys[i]));
             }
-            else
+            i++;
+        }
+    }
+
+    int numberOfOccurrences = NO_OCCURRENCES;
+    if (l -> mode == UNROLLED_MODE)
+    {
+        numberOfOccurrences = removeUnrolledValues(l, &set, remainingOccurrences);
+    }
+    else if (l -> mode == ORDERED_MODE)
+    {
+        // Each different value is removed by its own search.
+        i = 0;
+        while (i < k)
+        {
+            if (findInValueSet(&set, &(set.keys[i]), NULL) == i)
             {
-                previousNode = currentNode;
-                currentNode = currentNode -> next;
+                set.counts[i] = removeOrderedData(l, &(set.keys[i]), l -> size);
+                numberOfOccurrences += set.counts[i];
             }
             i++;
         }
+    }
+    else
+    {
+        numberOfOccurrences = removeLinkedNodes(l, matchNodeInSet, &set, set.counts,
+                                                remainingOccurrences);
+        if (numberOfOccurrences == MYLIST_ERROR_CODE)
+        {
+            freeValueSet(&set);
+            return MYLIST_ERROR_CODE;
+        }
+    }
 
+    i = 0;
+    while (i < k)
+    {
+        int const position = findInValueSet(&set, &(set.keys[i]), NULL);
+        if ((position == i) && (l -> index != NULL) && (set.counts[i] > NO_OCCURRENCES))
+        {
+            removeFromIndex(l -> index, &(set.keys[i]), set.counts[i]);
+        }
+        if (counts != NULL)
+        {
+            counts[i] = set.counts[position];
+        }
+        i++;
     }
+    freeValueSet(&set);
     return numberOfOccurrences;
-
 }
 
 /**
- * @brief Adds the given value to the beginning of the Linked List
- *        (the Linked List may contain duplicates).
-          'val' may be changed/deleted and your Linked List should not be effected by that.
- * @param l A pointer to the LinkedList to add the value to.
- * @param val The value to add, a (char *) value type.
+ * @brief Sorts the given Linked List in place with a stable bottom up merge sort, which relinks
+ *        the existing Nodes and allocates nothing (except for copies of Nodes shared with clones).
+ *        An unrolled or a mapped Linked List can not be sorted, and an ordered Linked List is
+ *        already sorted by strcmp and can not be sorted by another function.
+ * @param l A pointer to the Linked List to sort.
+ * @param cmp The function which compares two values, as strcmp does, or NULL for strcmp.
  * @return true iff succeed.
  */
-bool insertFirst(MyLinkedListP l, char const *val)
+bool sortList(MyLinkedListP l, int (*cmp)(char const *, char const *))
 {
-    if ((l != NULL) && (val != NULL))
+    STATS_CALL(SORT_LIST_CALL);
+    if ((l == NULL) || (l -> mode == UNROLLED_MODE) || (l -> mode == MAPPED_MODE) ||
+        !(unshareNodes(l)))
     {
-        Node *currentHead = l -> head;
-        Node *newHead = createNode(val);
-        if (newHead != NULL)
+        return false;
+    }
+    if (l -> mode == ORDERED_MODE)
+    {
+        return (cmp == NULL) || (cmp == strcmp);
+    }
+    if (cmp == NULL)
+    {
+        cmp = strcmp;
+    }
+
+    // The i-th run is either empty or holds 2^i sorted Nodes which came before the Nodes of the
+    // lower runs. Each Node is added as a run of one Node and merged up like a binary counter,
+    // so the merges work on Nodes that were visited recently.
+    Node *runs[NUMBER_OF_SORT_RUNS];
+    int i = 0;
+    while (i < NUMBER_OF_SORT_RUNS)
+    {
+        runs[i] = NULL;
+        i++;
+    }
+    Node *pRest = l -> head;
+    while (pRest != NULL)
+    {
+        Node *pRun = pRest;
+        pRest = pRest -> next;
+        pRun -> next = NULL;
+        i = 0;
+        while ((i < NUMBER_OF_SORT_RUNS - 1) && (runs[i] != NULL))
         {
-            newHead -> next = currentHead;
-            l -> head = newHead;
-            (l -> size)++;
-            return true;
+            pRun = mergeRuns(runs[i], pRun, cmp);
+            runs[i] = NULL;
+            i++;
         }
-        freeNode(newHead); // If the action did not succeed.
+        runs[i] = mergeRuns(runs[i], pRun, cmp);
     }
-    return false;
+
+    Node *pSorted = NULL;
+    i = 0;
+    while (i < NUMBER_OF_SORT_RUNS)
+    {
+        pSorted = mergeRuns(runs[i], pSorted, cmp);
+        i++;
+    }
+    l -> head = pSorted;
+    if (l -> mode == DOUBLY_LINKED_MODE)
+    {
+        relinkPreviousNodes(l);
+    }
+    return true;
 }
 
 /**
- * @brief Search the given value in the Linked List.
- * @param l A pointer to the LinkedList to search in.
- * @param val The value to search for, a (char *) value type.
- * @return The number of occurrences of the given value in the Linked List,
- *         or MYLIST_ERROR_CODE if an error occurred.
+ * @brief Removes the values of the given Linked List which are equal to the value before them,
+ *        so a sorted Linked List is left with a single occurrence of each value.
+ *        An unrolled or a mapped Linked List is not supported.
+ * @param l A pointer to the Linked List.
+ * @return The number of elements that were removed, or MYLIST_ERROR_CODE if an error occurred.
  */
-int isInList(MyLinkedListP const l, char const *val)
+int uniqueList(MyLinkedListP l)
 {
-    if ((l != NULL) && (val != NULL))
+    STATS_CALL(UNIQUE_LIST_CALL);
+    if ((l == NULL) || (l -> mode == UNROLLED_MODE) || (l -> mode == MAPPED_MODE) ||
+        !(unshareNodes(l)))
     {
-        int numberOfOccurrences = NO_OCCURRENCES;
+        return MYLIST_ERROR_CODE;
+    }
+    if (l -> mode == ORDERED_MODE)
+    {
+        return uniqueOrderedList(l);
+    }
 
-        Node *currentNode = l -> head;
-        while (currentNode != NULL)
+    int numberOfOccurrences = NO_OCCURRENCES;
+    Node *currentNode = l -> head;
+    while ((currentNode != NULL) && (currentNode -> next != NULL))
+    {
+        Node *nextNode = currentNode -> next;
+        ValueKey const key = getNodeKey(currentNode);
+        if (isNodeEqual(nextNode, &key))
         {
-            assert((currentNode -> data) != NULL);
-            if (strcmp((currentNode -> data), val) == STRING_EQUALITY)
+            if (l -> index != NULL)
             {
-                numberOfOccurrences++;
+                removeFromIndex(l -> index, &key, 1);
             }
-
-            currentNode = currentNode -> next;
+            l -> bytes -= getListNodeSize(l, nextNode);
+            currentNode -> next = releaseNode(l, nextNode);
+            setPreviousNode(l, currentNode -> next, currentNode);
+            numberOfOccurrences++;
+        }
+        else
+        {
+            currentNode = nextNode;
         }
-        return numberOfOccurrences;
-
-    }
-    else
-    {
-        return MYLIST_ERROR_CODE;
     }
+    l -> size -= numberOfOccurrences;
+    return numberOfOccurrences;
 }
 
+#ifdef STATS
 /**
- * @brief Gets the size of the given Linked List.
- * @param l A pointer to the Linked List.
- * @return The number of elements in the Linked List, or MYLIST_ERROR_CODE if an error occurred.
+ * @brief Adds a single counter of the List Stats to the given List Writer.
+ * @param pWriter A pointer to the List Writer.
+ * @param name The name of the counter.
+ * @param pCounter A pointer to the counter, which is read atomically.
  */
-int getSize(MyLinkedListP const l)
+static void addStatToWriter(ListWriter *pWriter, char const *name, long *pCounter)
 {
-    if (l != NULL)
-    {
-        int const numberOfElements = l -> size;
-        assert(numberOfElements >= EMPTY_LIST_SIZE);
-        return numberOfElements;
-    }
-    else
-    {
-        return MYLIST_ERROR_CODE;
-    }
+    char line[STATS_LINE_SIZE];
+    long const value = __atomic_load_n(pCounter, __ATOMIC_RELAXED);
+    int const length = snprintf(line, sizeof(line), STATS_OUTPUT, name, value);
+    addToWriter(pWriter, line, length);
+    return;
 }
+#endif
 
 /**
- * @brief Returns the size in bytes of the given Linked List and all it's contents.
- *		  Equivalent to sum of sizeof for all the Linked List contents.
- * @param l A pointer to the Linked List.
- * @return The allocated size for to the Linked List.
+ * @brief Writes the List Stats, the counters of all the Linked Lists, to the given file
+ *        descriptor: allocations, frees and bytes of the library, Nodes and Blocks taken from
+ *        Node Pools, comparisons of values, the largest size of a Linked List and the number of
+ *        calls of each public function, including the calls the library makes itself.
+ *        The counters exist only when the library is built with STATS, otherwise they cost
+ *        nothing and no operation is performed.
+ * @param fd The file descriptor to write to.
+ * @return true iff the List Stats exist and were written.
  */
-int getSizeOf(MyLinkedListP const l)
+bool printListStats(int const fd)
 {
-    int sizeOf = NO_ALLOCATE_SIZE;
-    if (l != NULL)
+#ifdef STATS
+    ListWriter writer;
+    initializeWriter(&writer, NULL, fd);
+    addStatToWriter(&writer, "allocations", &(gListStats.allocations));
+    addStatToWriter(&writer, "frees", &(gListStats.frees));
+    addStatToWriter(&writer, "bytes", &(gListStats.bytes));
+    addStatToWriter(&writer, "peakBytes", &(gListStats.peakBytes));
+    addStatToWriter(&writer, "poolAllocations", &(gListStats.poolAllocations));
+    addStatToWriter(&writer, "poolFrees", &(gListStats.poolFrees));
+    addStatToWriter(&writer, "comparisons", &(gListStats.comparisons));
+    addStatToWriter(&writer, "byteComparisons", &(gListStats.byteComparisons));
+    addStatToWriter(&writer, "peakSize", &(gListStats.peakSize));
+    int i = 0;
+    while (i < NUMBER_OF_LIST_FUNCTIONS)
     {
-        sizeOf += sizeof(MyLinkedList);
-
-        if ((l -> head) != NULL)
-        {
-            int const numberOfElements = (l -> size);
-            assert(numberOfElements >= EMPTY_LIST_SIZE);
-            Node *currentNode = l -> head;
-
-            // Add the sizeof for each Node in the Linked List.
-            int i = 0;
-            while (i < numberOfElements)
-            {
-                assert(currentNode != NULL);
-                sizeOf += getSizeOfNode(currentNode);
-                currentNode = currentNode -> next;
-                i++;
-            }
-        }
+        addStatToWriter(&writer, gListFunctionNames[i], &(gListStats.calls[i]));
+        i++;
     }
-    return sizeOf;
+    flushWriter(&writer);
+    return !(writer.failed);
+#else
+    (void)fd;
+    return false;
+#endif
+}
+
+/**
+ * @brief Sets all the counters of the List Stats to zero, except for the bytes which are still
+ *        allocated. Without STATS no operation is performed.
+ */
+void resetListStats()
+{
+#ifdef STATS
+    long const bytes = __atomic_load_n(&(gListStats.bytes), __ATOMIC_RELAXED);
+    memset(&gListStats, 0, sizeof(gListStats));
+    gListStats.bytes = bytes;
+    gListStats.peakBytes = bytes;
+#endif
+    return;
 }
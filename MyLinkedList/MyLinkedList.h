@@ -41,6 +41,28 @@
 //struct _MyLinkedList;
 typedef struct _MyLinkedList *MyLinkedListP;
 
+/*
+	MyInternPoolP is a pointer for a pool of interned strings, which can be shared by many
+	LinkedLists
+*/
+typedef struct _MyInternPool *MyInternPoolP;
+
+/*
+	MyListNodeP is a handle of a single node of a LinkedList created by createDoublyLinkedList
+*/
+typedef struct _MyListNode *MyListNodeP;
+
+/*
+	MyListIterator walks over the values of a LinkedList, set it with iterateList and read the
+	values with nextInList. its fields are private.
+*/
+typedef struct MyListIterator
+{
+    MyLinkedListP list;
+    void const *current;
+    int position;
+} MyListIterator;
+
 
 // ------------------------------ functions -----------------------------
 
@@ -54,10 +76,93 @@ typedef struct _MyLinkedList *MyLinkedListP;
  */
 MyLinkedListP createList();
 
+/**
+ * @brief Allocates a new empty unrolled LinkedList, which stores many values in each block
+ * 			instead of a single value in each node. all the functions keep the same semantics.
+ * 			It is the caller's responsibility to free the returned LinkedList.
+ *
+ * RETURN VALUE:
+ * @return a pointer to the new LinkedList, or NULL if the allocation failed.
+ */
+MyLinkedListP createUnrolledList();
+
+/**
+ * @brief Allocates a new empty concurrent LinkedList, which can be used by many threads at once.
+ * 			This list is experimental: its scaling on many cores was not measured yet.
+ * 			insertFirst, insertMany, removeData, isInList, getSize and cloneList are thread safe
+ * 			for it. isInList and cloneList take no lock, insertFirst and insertMany swap the head
+ * 			by compare and swap, and removeData locks only the node it unlinks and the one before
+ * 			it. A removed node is freed once every scan that may still be on it has ended, so
+ * 			removeData may wait for such scans.
+ * 			indexList is not supported. the other functions must not run together with any other
+ * 			operation on the list.
+ * 			It is the caller's responsibility to free the returned LinkedList.
+ *
+ * RETURN VALUE:
+ * @return a pointer to the new LinkedList, or NULL if the allocation failed.
+ */
+MyLinkedListP createConcurrentList();
+
+/**
+ * @brief Allocates a new empty ordered LinkedList, which keeps its values sorted by strcmp in a
+ * 			skip list. isInList, removeData and insertFirst, which adds the value in its sorted
+ * 			place instead of first, take O(log n) expected time. the other functions see a sorted
+ * 			list. sortList succeeds only with strcmp, and cloneList copies the nodes.
+ * 			It is the caller's responsibility to free the returned LinkedList.
+ *
+ * RETURN VALUE:
+ * @return a pointer to the new LinkedList, or NULL if the allocation failed.
+ */
+MyLinkedListP createOrderedList();
+
+/**
+ * @brief Allocates a new empty doubly linked LinkedList, whose nodes are linked to the previous
+ * 			node too. insertFirstNode returns a handle of the new node, which removeNode removes
+ * 			in constant time. cloneList copies the nodes.
+ * 			It is the caller's responsibility to free the returned LinkedList.
+ *
+ * RETURN VALUE:
+ * @return a pointer to the new LinkedList, or NULL if the allocation failed.
+ */
+MyLinkedListP createDoublyLinkedList();
+
+/**
+ * @brief Allocates a new empty intern pool, which keeps a single copy of each value of the lists
+ * 			created with it by createInternedList.
+ * 			It is the caller's responsibility to free the returned pool.
+ *
+ * RETURN VALUE:
+ * @return a pointer to the new pool, or NULL if the allocation failed.
+ */
+MyInternPoolP createInternPool();
+
+/**
+ * @brief Frees the intern pool. the lists created with it keep using it, and it is freed
+ * 			with the last of them.
+ * @param pool the pool to free.
+ */
+void freeInternPool(MyInternPoolP pool);
+
+/**
+ * @brief Allocates a new empty LinkedList whose nodes point to the single copy of their value
+ * 			in the given intern pool instead of a copy of their own. a value is freed with the
+ * 			last node which points to it. removeData and isInList compare pointers only. the
+ * 			lists of a pool must not be used by more than a single thread at once.
+ * 			It is the caller's responsibility to free the returned LinkedList.
+ * @param pool the intern pool.
+ *
+ * RETURN VALUE:
+ * @return a pointer to the new LinkedList, or NULL if the allocation failed.
+ */
+MyLinkedListP createInternedList(MyInternPoolP pool);
+
 
 /**
  * @brief Allocates a new MyLinkedList with the same values as l. It is the caller's
  * 			responsibility to free the returned LinkedList.
+ * 			a list created by createList shares its nodes with the clone, which takes constant
+ * 			time. the nodes are copied only when one of the lists removes a shared node, so
+ * 			l and the clone stay independent.
  * @param l the MyLinkedListP to clone.
  * RETURN VALUE:
  *   @return a pointer to the new LinkedList, or NULL if the allocation failed.
@@ -77,6 +182,60 @@ void freeList(MyLinkedListP l);
  */
 void printList(MyLinkedListP l);
 
+/**
+ * @brief write LinkedList l and it's contents to a file descriptor, in the format of printList.
+ * 			the output is buffered, so a small list is written with a single write.
+ * @param l the LinkedList to write.
+ * @param fd the file descriptor to write to.
+ * RETURN VALUE:
+ *   @return number of bytes that were written. or MYLIST_ERROR_CODE if an error occurred
+ */
+int writeList(MyLinkedListP l, int fd);
+
+/**
+ * @brief write LinkedList l and it's contents to a buffer of the caller, in the format of
+ * 			printList. like snprintf, at most size - 1 bytes are written and then a terminator,
+ * 			and a NULL buffer with size 0 only measures the output. no memory is allocated.
+ * @param l the LinkedList to write.
+ * @param buffer the buffer to write to.
+ * @param size the number of bytes in the buffer.
+ * RETURN VALUE:
+ *   @return number of bytes of the whole output, without the terminator. the output was cut
+ *   		 iff it is not less than size. or MYLIST_ERROR_CODE if an error occurred
+ */
+int writeListToBuffer(MyLinkedListP l, char *buffer, int size);
+
+/**
+ * @brief save the values of LinkedList l to a file, in a compact binary format which keeps the
+ * 			order of the values. the file is in the byte order of the machine.
+ * @param l the LinkedList to save.
+ * @param path the path of the file, which is created or replaced.
+ * RETURN VALUE:
+ *   @return true iff succeed
+ */
+bool saveList(MyLinkedListP l, char const *path);
+
+/**
+ * @brief Allocates a new LinkedList with the values saved by saveList in a file.
+ * 			It is the caller's responsibility to free the returned LinkedList.
+ * @param path the path of the file.
+ * RETURN VALUE:
+ *   @return a pointer to the new LinkedList, or NULL if the file is not valid or an error occurred.
+ */
+MyLinkedListP loadList(char const *path);
+
+/**
+ * @brief Allocates a new read only LinkedList which reads the values saved by saveList directly
+ * 			from a mapping of the file, without allocating them. the functions which change a
+ * 			list return an error for it, and cloneList returns a regular list with its values.
+ * 			the file must not be changed while the list is used.
+ * 			It is the caller's responsibility to free the returned LinkedList.
+ * @param path the path of the file.
+ * RETURN VALUE:
+ *   @return a pointer to the new LinkedList, or NULL if the file is not valid or an error occurred.
+ */
+MyLinkedListP mapList(char const *path);
+
 /**
  * @brief remove all the ocuurences of val in l 
  * @param l the LinkedList
@@ -96,6 +255,68 @@ int removeData(MyLinkedListP l, char const *val);
  */
 bool insertFirst(MyLinkedListP l, char const *val);
 
+/**
+ * @brief add all the values to the beginning of the list, one after the other, as if insertFirst
+ * 			was called for each of them. either all the values are added or none.
+ * @param l the LinkedList
+ * @param vals the values - char *
+ * @param k the number of values
+ * RETURN VALUE:
+ *   @return true iff succeed
+ */
+bool insertMany(MyLinkedListP l, char const * const *vals, int k);
+
+/**
+ * @brief remove all the occurrences of all the values in l, in a single pass over the list
+ * @param l the LinkedList
+ * @param vals the values - char *, may contain duplicates
+ * @param k the number of values
+ * @param counts if not NULL, counts[i] is set to the number of removed occurrences of vals[i]
+ * RETURN VALUE:
+ *   @return number of elements that were removed. or MYLIST_ERROR_CODE if an error occurred
+ */
+int removeMany(MyLinkedListP l, char const * const *vals, int k, int *counts);
+
+/**
+ * @brief sort the list in place with a stable merge sort, without allocating new nodes.
+ * 			a list created by createUnrolledList can not be sorted.
+ * @param l the LinkedList
+ * @param cmp compares two values as strcmp does, or NULL for strcmp
+ * RETURN VALUE:
+ *   @return true iff succeed
+ */
+bool sortList(MyLinkedListP l, int (*cmp)(char const *, char const *));
+
+/**
+ * @brief remove every value which is equal to the value before it, so a sorted list keeps a
+ * 			single occurrence of each value. not supported for a list created by
+ * 			createUnrolledList.
+ * @param l the LinkedList
+ * RETURN VALUE:
+ *   @return number of elements that were removed. or MYLIST_ERROR_CODE if an error occurred
+ */
+int uniqueList(MyLinkedListP l);
+
+/**
+ * @brief add val to the beginning of a list created by createDoublyLinkedList, as insertFirst
+ * 			does, and return a handle of its node.
+ * @param l the LinkedList
+ * @param val the value to add
+ * RETURN VALUE:
+ *   @return a handle of the new node, valid until it is removed. or NULL if an error occurred
+ */
+MyListNodeP insertFirstNode(MyLinkedListP l, char const *val);
+
+/**
+ * @brief remove the node of the given handle from the list in constant time.
+ * 			the handle is not valid after the call.
+ * @param l the LinkedList
+ * @param node a handle returned by insertFirstNode for this list, whose node was not removed
+ * RETURN VALUE:
+ *   @return true iff succeed
+ */
+bool removeNode(MyLinkedListP l, MyListNodeP node);
+
 /**
  * @brief search val in the list 
  * @param l the LinkedList 
@@ -122,4 +343,59 @@ int getSize(MyLinkedListP const l);
  *   @return the allocated size for l 
  */
 int getSizeOf(MyLinkedListP const l);
+
+/**
+ * @brief build an index of l which maps each value to the number of its occurrences. the index is
+ *			kept up to date by all the other functions (and cloned by cloneList), so isInList
+ *			takes constant time and removeData of a missing value returns immediately.
+ * @param l the LinkedList
+ * RETURN VALUE:
+ *   @return true iff succeed
+ */
+bool indexList(MyLinkedListP l);
+
+/**
+ * @brief set iterator to the first value of l. the iterator is valid as long as l is not changed.
+ * @param l the LinkedList
+ * @param iterator the iterator to set
+ * RETURN VALUE:
+ *   @return true iff succeed
+ */
+bool iterateList(MyLinkedListP const l, MyListIterator *iterator);
+
+/**
+ * @brief get the value iterator points to and advance it. the value is not copied.
+ * @param iterator the iterator
+ * RETURN VALUE:
+ *   @return the value, or NULL after the last value of the list
+ */
+char const * nextInList(MyListIterator *iterator);
+
+/**
+ * @brief combine the values of l from first to last: accumulator = combine(accumulator, val).
+ *			the values are passed without copying.
+ * @param l the LinkedList
+ * @param combine the function to call for each value
+ * @param accumulator the initial accumulator
+ * RETURN VALUE:
+ *   @return the last accumulator, or NULL if an error occurred
+ */
+void * foldList(MyLinkedListP const l, void * (*combine)(void *accumulator, char const *val),
+				void *accumulator);
+
+/**
+ * @brief write the counters of all the lists to a file descriptor: allocations, frees, bytes,
+ * 			comparisons, peak size and calls of each function. the counters exist only when the
+ * 			library is built with STATS defined ('make STATS=1'), otherwise they cost nothing
+ * 			and nothing is written.
+ * @param fd the file descriptor to write to.
+ * RETURN VALUE:
+ *   @return true iff the counters exist and were written
+ */
+bool printListStats(int fd);
+
+/**
+ * @brief set all the counters of the lists to zero. does nothing without STATS.
+ */
+void resetListStats();
 #endif // MYLINKEDLIST
\ No newline at end of file
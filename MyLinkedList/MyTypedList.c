@@ -0,0 +1,29 @@
+/**
+ * @file MyTypedList.c
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 17 Aug 2016
+ *
+ * @brief The typed Linked Lists which are declared in MyTypedList.h.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * The typed Linked Lists which are declared in MyTypedList.h.
+ * Input:       No particular input.
+ * Process:     Defines the functions of each typed Linked List with DEFINE_TYPED_LIST.
+ * Output:      Depends on the specific driver that used these operations.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include "MyTypedList.h"
+
+
+/*-----=  Typed Linked Lists  =-----*/
+
+
+DEFINE_TYPED_LIST(int, int, TYPED_LIST_EQUAL_VALUES)
@@ -0,0 +1,365 @@
+#ifndef _MYTYPEDLIST_H
+#define _MYTYPEDLIST_H
+
+
+/**
+ * @file MyTypedList.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 17 Aug 2016
+ *
+ * @brief Templates for Linked Lists of a single fixed size type, with the API of MyLinkedList.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * Templates for Linked Lists of a single fixed size type, with the API of MyLinkedList.
+ * A Linked List of values of the type Type is declared by DECLARE_TYPED_LIST(Name, Type) in
+ * every file which uses it, and defined by DEFINE_TYPED_LIST(Name, Type, isEqual) in a single
+ * file. Type may be any type which can be assigned, such as int or a struct with no pointers to
+ * memory it owns. isEqual is a function or a function like Macro which gets two pointers to
+ * values and checks if they are equal, such as TYPED_LIST_EQUAL_VALUES for numbers or
+ * TYPED_LIST_EQUAL_BYTES for a struct with no padding.
+ * The values are stored inline in the Nodes, so a Node takes a single pointer more than its
+ * value, and the Nodes are taken from Chunks of TYPED_LIST_CHUNK_NODES Nodes, which are freed
+ * only with the whole Linked List.
+ * The templates create the following, where Name is the name given to them:
+ *  MyLinkedList_Name, MyLinkedList_NameP   The Linked List and a pointer to it, which is defined
+ *                                          only in the file of DEFINE_TYPED_LIST.
+ *  createList_Name()                       Allocates a new empty Linked List, or returns NULL.
+ *  cloneList_Name(l)                       Allocates a copy of l, or returns NULL.
+ *  freeList_Name(l)                        Frees l, which may be NULL.
+ *  printList_Name(l, printValue)           Prints l in the format of printList, and each value
+ *                                          with printValue(Type const *).
+ *  insertFirst_Name(l, val)                Adds val to the beginning of l, returns true iff
+ *                                          succeed.
+ *  removeData_Name(l, val)                 Removes all the occurrences of val, returns their
+ *                                          number, or MYLIST_ERROR_CODE.
+ *  isInList_Name(l, val)                   Returns the number of occurrences of val, or
+ *                                          MYLIST_ERROR_CODE.
+ *  getSize_Name(l)                         Returns the number of values, or MYLIST_ERROR_CODE.
+ *  getSizeOf_Name(l)                       Returns the number of bytes of the Linked List and
+ *                                          its Nodes, or MYLIST_ERROR_CODE.
+ *  foldList_Name(l, combine, accumulator)  Combines the values, from the first to the last, as
+ *                                          foldList does, with combine(void *, Type const *).
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "MyLinkedList.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def TYPED_LIST_CHUNK_NODES 256
+ * @brief A Macro that sets the number of Nodes in each Chunk of a typed Linked List.
+ */
+#define TYPED_LIST_CHUNK_NODES 256
+
+/**
+ * @def TYPED_LIST_EMPTY_MESSAGE "Empty!\n"
+ * @brief A Macro that sets the message when trying to print an empty typed Linked List.
+ */
+#define TYPED_LIST_EMPTY_MESSAGE "Empty!\n"
+
+/**
+ * @def TYPED_LIST_NODE_PREFIX "'"
+ * @brief A Macro that sets the output before the value of a single Node print.
+ */
+#define TYPED_LIST_NODE_PREFIX "'"
+
+/**
+ * @def TYPED_LIST_NODE_SUFFIX "'->"
+ * @brief A Macro that sets the output after the value of a single Node print.
+ */
+#define TYPED_LIST_NODE_SUFFIX "'->"
+
+/**
+ * @def TYPED_LIST_END_OUTPUT "|| size:%d \n"
+ * @brief A Macro that sets the output in the end of a typed Linked List printing process.
+ */
+#define TYPED_LIST_END_OUTPUT "|| size:%d \n"
+
+/**
+ * @def TYPED_LIST_EQUAL_VALUES(pFirst, pSecond) (*(pFirst) == *(pSecond))
+ * @brief A Macro that checks if two values of a type which can be compared by == are equal.
+ */
+#define TYPED_LIST_EQUAL_VALUES(pFirst, pSecond) (*(pFirst) == *(pSecond))
+
+/**
+ * @def TYPED_LIST_EQUAL_BYTES(pFirst, pSecond)
+ * @brief A Macro that checks if two values are equal byte by byte, for a struct with no padding.
+ */
+#define TYPED_LIST_EQUAL_BYTES(pFirst, pSecond) \
+    (memcmp((pFirst), (pSecond), sizeof(*(pFirst))) == 0)
+
+
+/*-----=  Templates  =-----*/
+
+
+/**
+ * @def DECLARE_TYPED_LIST(Name, Type)
+ * @brief A Macro that declares a Linked List of values of the given type and its functions.
+ *        The Linked List is declared only by name, as MyLinkedList, and its struct is defined by
+ *        DEFINE_TYPED_LIST.
+ */
+#define DECLARE_TYPED_LIST(Name, Type) \
+    typedef struct MyLinkedList_##Name MyLinkedList_##Name; \
+    typedef MyLinkedList_##Name *MyLinkedList_##Name##P; \
+    MyLinkedList_##Name##P createList_##Name(); \
+    MyLinkedList_##Name##P cloneList_##Name(MyLinkedList_##Name##P l); \
+    void freeList_##Name(MyLinkedList_##Name##P l); \
+    void printList_##Name(MyLinkedList_##Name##P l, void (*printValue)(Type const *)); \
+    bool insertFirst_##Name(MyLinkedList_##Name##P l, Type val); \
+    int removeData_##Name(MyLinkedList_##Name##P l, Type val); \
+    int isInList_##Name(MyLinkedList_##Name##P l, Type val); \
+    int getSize_##Name(MyLinkedList_##Name##P l); \
+    int getSizeOf_##Name(MyLinkedList_##Name##P l); \
+    void * foldList_##Name(MyLinkedList_##Name##P l, \
+                           void * (*combine)(void *accumulator, Type const *val), \
+                           void *accumulator)
+
+/**
+ * @def DEFINE_TYPED_LIST(Name, Type, isEqual)
+ * @brief A Macro that defines the Linked List of values of the given type and its functions,
+ *        which were declared by DECLARE_TYPED_LIST with the same name and type.
+ *        A Node holds a pointer to the next Node and the value itself. A Chunk holds a pointer to
+ *        the next Chunk and its Nodes. The Linked List holds its Head, its size, its Chunks, the
+ *        newest first, the number of Nodes taken from the newest Chunk, and a list of the freed
+ *        Nodes which can be taken again.
+ *        A new Node is taken from the freed Nodes first, then from the newest Chunk, and a new
+ *        Chunk is allocated only when the newest one is full. A removed Node goes back to the
+ *        freed Nodes, and the Chunks are freed together with the Linked List.
+ */
+#define DEFINE_TYPED_LIST(Name, Type, isEqual) \
+    typedef struct Node_##Name \
+    { \
+        struct Node_##Name *next; \
+        Type value; \
+    } Node_##Name; \
+    typedef struct Chunk_##Name \
+    { \
+        struct Chunk_##Name *next; \
+        Node_##Name nodes[TYPED_LIST_CHUNK_NODES]; \
+    } Chunk_##Name; \
+    struct MyLinkedList_##Name \
+    { \
+        Node_##Name *head; \
+        int size; \
+        Chunk_##Name *chunks; \
+        int chunkUsed; \
+        Node_##Name *freeNodes; \
+    }; \
+    static Node_##Name * allocateNode_##Name(MyLinkedList_##Name##P l) \
+    { \
+        Node_##Name *pNode = l -> freeNodes; \
+        if (pNode != NULL) \
+        { \
+            l -> freeNodes = pNode -> next; \
+            return pNode; \
+        } \
+        if ((l -> chunks == NULL) || (l -> chunkUsed == TYPED_LIST_CHUNK_NODES)) \
+        { \
+            Chunk_##Name *pChunk = (Chunk_##Name *)malloc(sizeof(Chunk_##Name)); \
+            if (pChunk == NULL) \
+            { \
+                return NULL; \
+            } \
+            pChunk -> next = l -> chunks; \
+            l -> chunks = pChunk; \
+            l -> chunkUsed = 0; \
+        } \
+        pNode = &(l -> chunks -> nodes[l -> chunkUsed]); \
+        (l -> chunkUsed)++; \
+        return pNode; \
+    } \
+    MyLinkedList_##Name##P createList_##Name() \
+    { \
+        MyLinkedList_##Name##P l = \
+            (MyLinkedList_##Name##P)malloc(sizeof(MyLinkedList_##Name)); \
+        if (l != NULL) \
+        { \
+            l -> head = NULL; \
+            l -> size = 0; \
+            l -> chunks = NULL; \
+            l -> chunkUsed = 0; \
+            l -> freeNodes = NULL; \
+        } \
+        return l; \
+    } \
+    void freeList_##Name(MyLinkedList_##Name##P l) \
+    { \
+        if (l != NULL) \
+        { \
+            Chunk_##Name *pChunk = l -> chunks; \
+            while (pChunk != NULL) \
+            { \
+                Chunk_##Name *pNext = pChunk -> next; \
+                free(pChunk); \
+                pChunk = pNext; \
+            } \
+            free(l); \
+        } \
+        return; \
+    } \
+    MyLinkedList_##Name##P cloneList_##Name(MyLinkedList_##Name##P l) \
+    { \
+        if (l == NULL) \
+        { \
+            return NULL; \
+        } \
+        MyLinkedList_##Name##P clone = createList_##Name(); \
+        if (clone == NULL) \
+        { \
+            return NULL; \
+        } \
+        Node_##Name **pTail = &(clone -> head); \
+        Node_##Name const *currentNode = l -> head; \
+        while (currentNode != NULL) \
+        { \
+            Node_##Name *pCopy = allocateNode_##Name(clone); \
+            if (pCopy == NULL) \
+            { \
+                freeList_##Name(clone); \
+                return NULL; \
+            } \
+            pCopy -> value = currentNode -> value; \
+            *pTail = pCopy; \
+            pTail = &(pCopy -> next); \
+            currentNode = currentNode -> next; \
+        } \
+        *pTail = NULL; \
+        clone -> size = l -> size; \
+        return clone; \
+    } \
+    void printList_##Name(MyLinkedList_##Name##P l, void (*printValue)(Type const *)) \
+    { \
+        if ((l == NULL) || (printValue == NULL)) \
+        { \
+            return; \
+        } \
+        if (l -> size == 0) \
+        { \
+            printf(TYPED_LIST_EMPTY_MESSAGE); \
+            return; \
+        } \
+        Node_##Name const *currentNode = l -> head; \
+        while (currentNode != NULL) \
+        { \
+            printf(TYPED_LIST_NODE_PREFIX); \
+            printValue(&(currentNode -> value)); \
+            printf(TYPED_LIST_NODE_SUFFIX); \
+            currentNode = currentNode -> next; \
+        } \
+        printf(TYPED_LIST_END_OUTPUT, l -> size); \
+        return; \
+    } \
+    bool insertFirst_##Name(MyLinkedList_##Name##P l, Type val) \
+    { \
+        if (l == NULL) \
+        { \
+            return false; \
+        } \
+        Node_##Name *newHead = allocateNode_##Name(l); \
+        if (newHead == NULL) \
+        { \
+            return false; \
+        } \
+        newHead -> value = val; \
+        newHead -> next = l -> head; \
+        l -> head = newHead; \
+        (l -> size)++; \
+        return true; \
+    } \
+    int removeData_##Name(MyLinkedList_##Name##P l, Type val) \
+    { \
+        if (l == NULL) \
+        { \
+            return MYLIST_ERROR_CODE; \
+        } \
+        int numberOfOccurrences = 0; \
+        Node_##Name **pLink = &(l -> head); \
+        while (*pLink != NULL) \
+        { \
+            Node_##Name *currentNode = *pLink; \
+            if (isEqual(&(currentNode -> value), &val)) \
+            { \
+                *pLink = currentNode -> next; \
+                currentNode -> next = l -> freeNodes; \
+                l -> freeNodes = currentNode; \
+                numberOfOccurrences++; \
+            } \
+            else \
+            { \
+                pLink = &(currentNode -> next); \
+            } \
+        } \
+        l -> size -= numberOfOccurrences; \
+        return numberOfOccurrences; \
+    } \
+    int isInList_##Name(MyLinkedList_##Name##P l, Type val) \
+    { \
+        if (l == NULL) \
+        { \
+            return MYLIST_ERROR_CODE; \
+        } \
+        int numberOfOccurrences = 0; \
+        Node_##Name const *currentNode = l -> head; \
+        while (currentNode != NULL) \
+        { \
+            if (isEqual(&(currentNode -> value), &val)) \
+            { \
+                numberOfOccurrences++; \
+            } \
+            currentNode = currentNode -> next; \
+        } \
+        return numberOfOccurrences; \
+    } \
+    int getSize_##Name(MyLinkedList_##Name##P l) \
+    { \
+        return (l != NULL) ? l -> size : MYLIST_ERROR_CODE; \
+    } \
+    int getSizeOf_##Name(MyLinkedList_##Name##P l) \
+    { \
+        if (l == NULL) \
+        { \
+            return MYLIST_ERROR_CODE; \
+        } \
+        return (int)(sizeof(MyLinkedList_##Name) + l -> size * sizeof(Node_##Name)); \
+    } \
+    void * foldList_##Name(MyLinkedList_##Name##P l, \
+                           void * (*combine)(void *accumulator, Type const *val), \
+                           void *accumulator) \
+    { \
+        if ((l == NULL) || (combine == NULL)) \
+        { \
+            return NULL; \
+        } \
+        Node_##Name const *currentNode = l -> head; \
+        while (currentNode != NULL) \
+        { \
+            accumulator = combine(accumulator, &(currentNode -> value)); \
+            currentNode = currentNode -> next; \
+        } \
+        return accumulator; \
+    }
+
+
+/*-----=  Typed Linked Lists  =-----*/
+
+
+/**
+ * A Linked List of int values, MyLinkedList_int, which is defined in MyTypedList.c.
+ */
+DECLARE_TYPED_LIST(int, int);
+
+
+#endif // _MYTYPEDLIST_H
@@ -0,0 +1,450 @@
+/**
+ * @file TypedListCheck.c
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 17 Aug 2016
+ *
+ * @brief A check of the typed Linked List of int values from MyTypedList.h.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A check of the typed Linked List of int values from MyTypedList.h.
+ * Input:       No input.
+ * Process:     Runs a random mix of insertFirst, removeData, isInList and cloneList on a typed
+ *              Linked List, and compares every result with a plain array of the same values.
+ *              The values of the Linked List, its size in bytes and its clones are checked along
+ *              the way. The printing of the empty and the final Linked List is redirected to a
+ *              temporary file and compared with the text of the array, and all the Linked Lists
+ *              are freed in the end.
+ * Output:      A message that states the check passed, or the first operation that failed.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+#include "MyTypedList.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def VALID_STATE 0
+ * @brief A Flag for valid state during the program run.
+ */
+#define VALID_STATE 0
+
+/**
+ * @def INVALID_STATE 1
+ * @brief A Flag for invalid state during the program run.
+ */
+#define INVALID_STATE 1
+
+/**
+ * @def NUMBER_OF_OPERATIONS 20000
+ * @brief A Macro that sets the number of random operations to check.
+ */
+#define NUMBER_OF_OPERATIONS 20000
+
+/**
+ * @def MAX_VALUES 1024
+ * @brief A Macro that sets the maximal number of values in the checked Linked List.
+ */
+#define MAX_VALUES 1024
+
+/**
+ * @def NUMBER_OF_KEYS 64
+ * @brief A Macro that sets the number of different values which are inserted and removed.
+ */
+#define NUMBER_OF_KEYS 64
+
+/**
+ * @def NUMBER_OF_CHOICES 8
+ * @brief A Macro that sets the number of equally likely choices of a random operation.
+ */
+#define NUMBER_OF_CHOICES 8
+
+/**
+ * @def INSERT_CHOICES 4
+ * @brief A Macro that sets the choices below which the operation is insertFirst.
+ */
+#define INSERT_CHOICES 4
+
+/**
+ * @def REMOVE_CHOICES 6
+ * @brief A Macro that sets the choices below which the operation is removeData.
+ */
+#define REMOVE_CHOICES 6
+
+/**
+ * @def SEARCH_CHOICES 7
+ * @brief A Macro that sets the choices below which the operation is isInList, and cloneList
+ *        above it.
+ */
+#define SEARCH_CHOICES 7
+
+/**
+ * @def CHECK_SEED 2016
+ * @brief A Macro that sets the seed of the random operations, so every run is the same.
+ */
+#define CHECK_SEED 2016
+
+/**
+ * @def PASSED_MESSAGE "Typed list check passed\n"
+ * @brief A Macro that sets the output message when all the checks passed.
+ */
+#define PASSED_MESSAGE "Typed list check passed\n"
+
+/**
+ * @def FAILED_MESSAGE "Typed list check failed: %s in operation %d\n"
+ * @brief A Macro that sets the output message when a check failed.
+ */
+#define FAILED_MESSAGE "Typed list check failed: %s in operation %d\n"
+
+/**
+ * @def VALUE_OUTPUT "%d"
+ * @brief A Macro that sets the output of a single value.
+ */
+#define VALUE_OUTPUT "%d"
+
+/**
+ * @def MAX_NODE_OUTPUT 32
+ * @brief A Macro that sets the maximal number of characters in the print of a single Node.
+ */
+#define MAX_NODE_OUTPUT 32
+
+/**
+ * @def MAX_LIST_OUTPUT ((MAX_VALUES + 1) * MAX_NODE_OUTPUT)
+ * @brief A Macro that sets the maximal number of characters in the print of a Linked List.
+ */
+#define MAX_LIST_OUTPUT ((MAX_VALUES + 1) * MAX_NODE_OUTPUT)
+
+
+/*-----=  Structs  =-----*/
+
+
+/**
+ * A Structure for the plain array of values which the typed Linked List is compared with.
+ * The values are stored from the last inserted to the first, as the Linked List holds them.
+ */
+typedef struct Model
+{
+    int values[MAX_VALUES];
+    int size;
+} Model;
+
+/**
+ * A Structure for the context of checkValue, the Model and the position of the next value.
+ */
+typedef struct ModelPosition
+{
+    Model const *pModel;
+    int position;
+    bool equal;
+} ModelPosition;
+
+
+/*-----=  Model Functions  =-----*/
+
+
+/**
+ * @brief Adds the given value to the beginning of the given Model.
+ * @param pModel A pointer to the Model.
+ * @param val The value to add.
+ */
+static void insertModel(Model *pModel, int const val)
+{
+    int i;
+    for (i = pModel -> size; i > 0; i--)
+    {
+        pModel -> values[i] = pModel -> values[i - 1];
+    }
+    pModel -> values[0] = val;
+    (pModel -> size)++;
+    return;
+}
+
+/**
+ * @brief Removes all the occurrences of the given value from the given Model.
+ * @param pModel A pointer to the Model.
+ * @param val The value to remove.
+ * @return The number of occurrences which were removed.
+ */
+static int removeModel(Model *pModel, int const val)
+{
+    int kept = 0;
+    int i;
+    for (i = 0; i < pModel -> size; i++)
+    {
+        if (pModel -> values[i] != val)
+        {
+            pModel -> values[kept++] = pModel -> values[i];
+        }
+    }
+    int const numberOfOccurrences = pModel -> size - kept;
+    pModel -> size = kept;
+    return numberOfOccurrences;
+}
+
+/**
+ * @brief Counts the occurrences of the given value in the given Model.
+ * @param pModel A pointer to the Model.
+ * @param val The value to count.
+ * @return The number of occurrences.
+ */
+static int countModel(Model const *pModel, int const val)
+{
+    int numberOfOccurrences = 0;
+    int i;
+    for (i = 0; i < pModel -> size; i++)
+    {
+        if (pModel -> values[i] == val)
+        {
+            numberOfOccurrences++;
+        }
+    }
+    return numberOfOccurrences;
+}
+
+
+/*-----=  Check Functions  =-----*/
+
+
+/**
+ * @brief Compares the given value of a Linked List with the next value of the Model, for
+ *        foldList_int.
+ * @param accumulator A pointer to the ModelPosition.
+ * @param val A pointer to the value.
+ * @return The ModelPosition.
+ */
+static void * checkValue(void *accumulator, int const *val)
+{
+    ModelPosition *pPosition = (ModelPosition *)accumulator;
+    if ((pPosition -> position >= pPosition -> pModel -> size) ||
+        (pPosition -> pModel -> values[pPosition -> position] != *val))
+    {
+        pPosition -> equal = false;
+    }
+    (pPosition -> position)++;
+    return pPosition;
+}
+
+/**
+ * @brief Checks that the given Linked List holds exactly the values of the given Model, in the
+ *        same order.
+ * @param l The Linked List.
+ * @param pModel A pointer to the Model.
+ * @return true iff they hold the same values.
+ */
+static bool isEqualToModel(MyLinkedList_intP l, Model const *pModel)
+{
+    ModelPosition position = {pModel, 0, true};
+    foldList_int(l, checkValue, &position);
+    return position.equal && (position.position == pModel -> size) &&
+           (getSize_int(l) == pModel -> size);
+}
+
+/**
+ * @brief Prints a single value, for printList_int.
+ * @param val A pointer to the value.
+ */
+static void printValue(int const *val)
+{
+    printf(VALUE_OUTPUT, *val);
+    return;
+}
+
+/**
+ * @brief Writes the text that printList_int prints for the given Model.
+ * @param pModel A pointer to the Model.
+ * @param output The buffer to write to, of MAX_LIST_OUTPUT characters.
+ * @return The number of characters written.
+ */
+static int writeModelOutput(Model const *pModel, char *output)
+{
+    if (pModel -> size == 0)
+    {
+        return snprintf(output, MAX_LIST_OUTPUT, TYPED_LIST_EMPTY_MESSAGE);
+    }
+    int length = 0;
+    int i;
+    for (i = 0; i < pModel -> size; i++)
+    {
+        length += snprintf(output + length, MAX_LIST_OUTPUT - length,
+                           TYPED_LIST_NODE_PREFIX VALUE_OUTPUT TYPED_LIST_NODE_SUFFIX,
+                           pModel -> values[i]);
+    }
+    length += snprintf(output + length, MAX_LIST_OUTPUT - length, TYPED_LIST_END_OUTPUT,
+                       pModel -> size);
+    return length;
+}
+
+/**
+ * @brief Checks that printList_int prints the given Linked List as the text of the given Model.
+ *        The standard output is redirected to a temporary file while the Linked List is printed,
+ *        and the file is then read back and compared with the text.
+ * @param l The Linked List.
+ * @param pModel A pointer to the Model.
+ * @return true iff the printed text is the text of the Model, false if it is different or the
+ *         standard output could not be redirected.
+ */
+static bool isPrintedAsModel(MyLinkedList_intP l, Model const *pModel)
+{
+    static char expected[MAX_LIST_OUTPUT];
+    static char printed[MAX_LIST_OUTPUT];
+    FILE *pOutput = tmpfile();
+    if (pOutput == NULL)
+    {
+        return false;
+    }
+    fflush(stdout);
+    int const savedStdout = dup(STDOUT_FILENO);
+    if ((savedStdout < 0) || (dup2(fileno(pOutput), STDOUT_FILENO) < 0))
+    {
+        if (savedStdout >= 0)
+        {
+            close(savedStdout);
+        }
+        fclose(pOutput);
+        return false;
+    }
+
+    printList_int(l, printValue);
+    fflush(stdout);
+    dup2(savedStdout, STDOUT_FILENO);
+    close(savedStdout);
+
+    rewind(pOutput);
+    size_t const printedLength = fread(printed, sizeof(char), MAX_LIST_OUTPUT, pOutput);
+    fclose(pOutput);
+    int const expectedLength = writeModelOutput(pModel, expected);
+    return (printedLength == (size_t)expectedLength) &&
+           (memcmp(printed, expected, printedLength) == 0);
+}
+
+
+/*-----=  Main  =-----*/
+
+
+/**
+ * @brief The main function that runs the check.
+ * @return 0 if all the checks passed, 1 otherwise.
+ */
+int main()
+{
+    MyLinkedList_intP l = createList_int();
+    MyLinkedList_intP clone = NULL;
+    Model model = {{0}, 0};
+    Model cloneModel = {{0}, 0};
+    char const *failure = NULL;
+    if (l == NULL)
+    {
+        failure = "createList";
+    }
+    if ((failure == NULL) && !(isPrintedAsModel(l, &model)))
+    {
+        failure = "printList of an empty Linked List";
+    }
+
+    // The Linked List and each of its Nodes take a fixed number of bytes.
+    int const emptySizeOf = getSizeOf_int(l);
+    if ((failure == NULL) && (emptySizeOf < (int)sizeof(int)))
+    {
+        failure = "getSizeOf";
+    }
+    int nodeSizeOf = 0;
+
+    unsigned int seed = CHECK_SEED;
+    int operation = 0;
+    while ((failure == NULL) && (operation < NUMBER_OF_OPERATIONS))
+    {
+        int const val = (int)(rand_r(&seed) % NUMBER_OF_KEYS);
+        int const choice = (int)(rand_r(&seed) % NUMBER_OF_CHOICES);
+        if ((choice < INSERT_CHOICES) && (model.size < MAX_VALUES))
+        {
+            if (!(insertFirst_int(l, val)))
+            {
+                failure = "insertFirst";
+            }
+            insertModel(&model, val);
+        }
+        else if (choice < REMOVE_CHOICES)
+        {
+            if (removeData_int(l, val) != removeModel(&model, val))
+            {
+                failure = "removeData";
+            }
+        }
+        else if (choice < SEARCH_CHOICES)
+        {
+            if (isInList_int(l, val) != countModel(&model, val))
+            {
+                failure = "isInList";
+            }
+        }
+        else
+        {
+            freeList_int(clone);
+            clone = cloneList_int(l);
+            cloneModel = model;
+            if ((clone == NULL) || !(isEqualToModel(clone, &cloneModel)))
+            {
+                failure = "cloneList";
+            }
+        }
+
+        if ((failure == NULL) && !(isEqualToModel(l, &model)))
+        {
+            failure = "the values";
+        }
+        if ((failure == NULL) && (nodeSizeOf == 0) && (model.size > 0))
+        {
+            nodeSizeOf = (getSizeOf_int(l) - emptySizeOf) / model.size;
+        }
+        if ((failure == NULL) && (getSizeOf_int(l) != emptySizeOf + model.size * nodeSizeOf))
+        {
+            failure = "getSizeOf";
+        }
+        operation++;
+    }
+
+    // A clone does not change when the Linked List it was copied from changes.
+    if ((failure == NULL) && (clone != NULL) && !(isEqualToModel(clone, &cloneModel)))
+    {
+        failure = "the values of the clone";
+    }
+    if ((failure == NULL) && ((getSize_int(NULL) != MYLIST_ERROR_CODE) ||
+                              (getSizeOf_int(NULL) != MYLIST_ERROR_CODE) ||
+                              (isInList_int(NULL, 0) != MYLIST_ERROR_CODE) ||
+                              (removeData_int(NULL, 0) != MYLIST_ERROR_CODE) ||
+                              insertFirst_int(NULL, 0) || (cloneList_int(NULL) != NULL)))
+    {
+        failure = "a NULL Linked List";
+    }
+    if ((failure == NULL) && !(isPrintedAsModel(l, &model)))
+    {
+        failure = "printList";
+    }
+
+    freeList_int(clone);
+    freeList_int(l);
+    freeList_int(NULL);
+
+    if (failure != NULL)
+    {
+        printf(FAILED_MESSAGE, failure, operation);
+        return INVALID_STATE;
+    }
+    printf(PASSED_MESSAGE);
+    return VALID_STATE;
+}